@@ -0,0 +1,195 @@
+#include "ClusteredLights.hpp"
+#include "LitColorTextureProgram.hpp"
+
+#include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "Profiler.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+//make a texture buffer object viewing 'buffer' as 'format':
+static void make_texture_buffer(GLenum format, GLuint *buffer, GLuint *texture) {
+	glGenBuffers(1, buffer);
+	glBindBuffer(GL_TEXTURE_BUFFER, *buffer);
+	glBufferData(GL_TEXTURE_BUFFER, 16, nullptr, GL_STREAM_DRAW); //(never empty, so the texture is always complete)
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+	glGenTextures(1, texture);
+	glBindTexture(GL_TEXTURE_BUFFER, *texture);
+	glTexBuffer(GL_TEXTURE_BUFFER, format, *buffer);
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+//replace the contents of a texture buffer (orphaning the old storage, so nothing waits on the last frame's draws):
+template< typename T >
+static void upload(GLuint buffer, std::vector< T > const &data) {
+	GLsizeiptr bytes = GLsizeiptr(data.size() * sizeof(T));
+	glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+	glBufferData(GL_TEXTURE_BUFFER, std::max< GLsizeiptr >(bytes, 16), nullptr, GL_STREAM_DRAW);
+	if (bytes) glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, data.data());
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+	PerfStats::count_upload(bytes);
+}
+
+ClusteredLights::ClusteredLights() {
+	make_texture_buffer(GL_RGBA32F, &lights_buffer, &lights_texture);
+	make_texture_buffer(GL_RG32UI, &clusters_buffer, &clusters_texture);
+	make_texture_buffer(GL_R16UI, &indices_buffer, &indices_texture);
+	GL_ERRORS();
+}
+
+ClusteredLights::~ClusteredLights() {
+	glDeleteTextures(1, &lights_texture);
+	glDeleteTextures(1, &clusters_texture);
+	glDeleteTextures(1, &indices_texture);
+	glDeleteBuffers(1, &lights_buffer);
+	glDeleteBuffers(1, &clusters_buffer);
+	glDeleteBuffers(1, &indices_buffer);
+}
+
+void ClusteredLights::update(std::list< Scene::Light > const &lights, Scene::Camera const &camera, glm::uvec2 const &drawable_size) {
+	PROFILE_ZONE("ClusteredLights::update");
+	assert(camera.transform);
+
+	glm::mat4x3 view_from_world = camera.transform->make_local_from_world();
+	glm::mat4 clip_from_view = camera.make_projection();
+	float near = camera.near;
+	float log_range = std::log(std::max(far, 2.0f * near) / near);
+
+	//(camera looks along -z, so depth is -z in view space)
+	depth_plane = -glm::vec4(view_from_world[0].z, view_from_world[1].z, view_from_world[2].z, view_from_world[3].z);
+	depth_scale = glm::vec2(float(counts.z) / log_range, -float(counts.z) * std::log(near) / log_range);
+	tile_size = glm::vec2(drawable_size) / glm::vec2(counts.x, counts.y);
+
+	auto slice = [&](float depth) -> uint32_t {
+		float s = std::log(std::max(depth, near)) * depth_scale.x + depth_scale.y;
+		return uint32_t(std::clamp(s, 0.0f, float(counts.z - 1)));
+	};
+
+	//light parameters (globals first, so the shader can loop over [0, global_lights)):
+	light_data.clear();
+	bounds.clear();
+	auto add_light = [&](Scene::Light const &light, float range) {
+		glm::mat4x3 world_from_light = light.transform->make_world_from_local();
+		float type = 0.0f;
+		switch (light.type) {
+			case Scene::Light::Point: type = 0.0f; break;
+			case Scene::Light::Hemisphere: type = 1.0f; break;
+			case Scene::Light::Spot: type = 2.0f; break;
+			case Scene::Light::Directional: type = 3.0f; break;
+		}
+		light_data.emplace_back(world_from_light[3], type);
+		light_data.emplace_back(-glm::normalize(world_from_light[2]), std::cos(0.5f * light.spot_fov));
+		light_data.emplace_back(light.energy, range);
+	};
+	for (Scene::Light const &light : lights) {
+		if (light.type == Scene::Light::Hemisphere || light.type == Scene::Light::Directional) {
+			add_light(light, 0.0f);
+		}
+	}
+	global_lights = uint32_t(light_data.size() / 3);
+
+	for (Scene::Light const &light : lights) {
+		if (light.type != Scene::Light::Point && light.type != Scene::Light::Spot) continue;
+		float energy = std::max(light.energy.r, std::max(light.energy.g, light.energy.b));
+		if (energy <= 0.0f) continue;
+		float range = std::sqrt(energy / cutoff);
+
+		//view-space bounding sphere:
+		glm::vec3 center = view_from_world * glm::vec4(light.transform->make_world_from_local()[3], 1.0f);
+		float depth = -center.z;
+		if (depth + range < near) continue; //entirely behind the camera
+
+		Bounds b;
+		b.min.z = slice(depth - range);
+		b.max.z = slice(depth + range);
+		b.min.x = b.min.y = 0;
+		b.max.x = counts.x - 1;
+		b.max.y = counts.y - 1;
+		if (depth - range > near) {
+			//in front of the near plane: tiles covered by the projection of the sphere's bounding box
+			glm::vec2 lo = glm::vec2( 1.0f), hi = glm::vec2(-1.0f);
+			for (uint32_t c = 0; c < 8; ++c) {
+				glm::vec3 corner = center + range * glm::vec3((c & 1 ? 1.0f : -1.0f), (c & 2 ? 1.0f : -1.0f), (c & 4 ? 1.0f : -1.0f));
+				glm::vec4 clip = clip_from_view * glm::vec4(corner, 1.0f);
+				glm::vec2 ndc = glm::vec2(clip) / clip.w;
+				lo = glm::min(lo, ndc);
+				hi = glm::max(hi, ndc);
+			}
+			if (hi.x < -1.0f || hi.y < -1.0f || lo.x > 1.0f || lo.y > 1.0f) continue; //off screen
+			glm::vec2 grid = glm::vec2(counts.x, counts.y);
+			glm::vec2 min = glm::clamp((lo * 0.5f + 0.5f) * grid, glm::vec2(0.0f), grid - 1.0f);
+			glm::vec2 max = glm::clamp((hi * 0.5f + 0.5f) * grid, glm::vec2(0.0f), grid - 1.0f);
+			b.min.x = uint32_t(min.x);
+			b.min.y = uint32_t(min.y);
+			b.max.x = uint32_t(max.x);
+			b.max.y = uint32_t(max.y);
+		}
+
+		b.light = uint32_t(light_data.size() / 3);
+		if (b.light > 0xffff) break; //(indices are 16 bits)
+		add_light(light, range);
+		bounds.emplace_back(b);
+	}
+	binned_lights = uint32_t(bounds.size());
+
+	//count, then fill, each cluster's list:
+	uint32_t cluster_count = counts.x * counts.y * counts.z;
+	clusters.assign(cluster_count, glm::uvec2(0));
+	auto for_each_cluster = [&](Bounds const &b, auto &&fn) {
+		for (uint32_t z = b.min.z; z <= b.max.z; ++z) {
+			for (uint32_t y = b.min.y; y <= b.max.y; ++y) {
+				for (uint32_t x = b.min.x; x <= b.max.x; ++x) {
+					fn(clusters[(z * counts.y + y) * counts.x + x]);
+				}
+			}
+		}
+	};
+	for (Bounds const &b : bounds) {
+		for_each_cluster(b, [](glm::uvec2 &cluster) { cluster.y += 1; });
+	}
+	references = 0;
+	for (glm::uvec2 &cluster : clusters) {
+		cluster.x = references;
+		references += cluster.y;
+		cluster.y = 0;
+	}
+	indices.resize(references);
+	for (Bounds const &b : bounds) {
+		for_each_cluster(b, [&](glm::uvec2 &cluster) {
+			indices[cluster.x + cluster.y] = uint16_t(b.light);
+			cluster.y += 1;
+		});
+	}
+
+	upload(lights_buffer, light_data);
+	upload(clusters_buffer, clusters);
+	upload(indices_buffer, indices);
+}
+
+void ClusteredLights::set_pipeline(Scene::Drawable::Pipeline *pipeline_) const {
+	assert(pipeline_);
+	auto &pipeline = *pipeline_;
+	pipeline.textures[1].texture = lights_texture;
+	pipeline.textures[1].target = GL_TEXTURE_BUFFER;
+	pipeline.textures[2].texture = clusters_texture;
+	pipeline.textures[2].target = GL_TEXTURE_BUFFER;
+	pipeline.textures[3].texture = indices_texture;
+	pipeline.textures[3].target = GL_TEXTURE_BUFFER;
+}
+
+void ClusteredLights::set_uniforms(LitColorTextureProgram const &program) const {
+	assert(program.variant.clustered);
+	glUseProgram(program.program);
+	glUniform1i(program.GLOBAL_LIGHTS_int, GLint(global_lights));
+	glUniform4fv(program.CLUSTER_DEPTH_PLANE_vec4, 1, glm::value_ptr(depth_plane));
+	glUniform2fv(program.CLUSTER_DEPTH_SCALE_vec2, 1, glm::value_ptr(depth_scale));
+	glUniform2fv(program.CLUSTER_TILE_SIZE_vec2, 1, glm::value_ptr(tile_size));
+	glUniform3i(program.CLUSTER_COUNTS_ivec3, GLint(counts.x), GLint(counts.y), GLint(counts.z));
+	glUseProgram(0);
+	PerfStats::count_state_changes(2);
+	PerfStats::count_uniform_uploads(5);
+}
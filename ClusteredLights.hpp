@@ -0,0 +1,86 @@
+#pragma once
+
+/*
+ * ClusteredLights bins a scene's lights into a grid of view-space cells
+ *  ("clusters": screen tiles x depth slices) every frame, so the clustered
+ *  LitColorTextureProgram variant only loops over the lights that can
+ *  reach each fragment's cluster:
+ *
+ * //once:
+ * ClusteredLights clustered;
+ * LitColorTextureProgram const &program = LitColorTextureProgram::get({Scene::Light::Hemisphere, true, true, false}); //(light, textured, clustered, shadowed)
+ * program.set_pipeline(&drawable.pipeline);
+ * clustered.set_pipeline(&drawable.pipeline); //(binds the light lists to texture units 1-3)
+ *
+ * //every frame:
+ * clustered.update(scene.lights, camera, drawable_size);
+ * clustered.set_uniforms(program);
+ * scene.draw(camera);
+ *
+ * Point and spot lights are bounded by the distance at which their
+ *  energy falls below 'cutoff' (the shader fades them to zero there);
+ *  hemisphere and directional lights reach everywhere, so they skip
+ *  binning and every fragment loops over them.
+ *
+ * Light lists are uploaded as texture buffers:
+ *  lights: RGBA32F, 3 texels per light -- (position, type), (direction, cos(spot_fov/2)), (energy, range)
+ *  clusters: RG32UI, 1 texel per cluster -- (first index, count)
+ *  indices: R16UI -- light numbers for each cluster
+ *
+ * Light space is assumed to be world space (as in Scene::draw(camera)).
+ *
+ */
+
+#include "Scene.hpp"
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <list>
+#include <vector>
+
+struct LitColorTextureProgram;
+
+struct ClusteredLights {
+	ClusteredLights();
+	~ClusteredLights();
+	ClusteredLights(ClusteredLights const &) = delete;
+	ClusteredLights &operator=(ClusteredLights const &) = delete;
+
+	//grid size (tiles across, tiles up, depth slices):
+	glm::uvec3 counts = glm::uvec3(16, 9, 24);
+	//depth slices are spaced logarithmically from the camera's near plane to 'far' (the last slice continues to infinity):
+	float far = 200.0f;
+	//a point or spot light's range ends where its energy (per the shader's 1/d^2 falloff) drops below this:
+	float cutoff = 0.02f;
+
+	//bin 'lights' as seen by 'camera' and upload the lists:
+	void update(std::list< Scene::Light > const &lights, Scene::Camera const &camera, glm::uvec2 const &drawable_size);
+
+	//bind the light lists (as textures 1-3) in a pipeline that uses a clustered LitColorTextureProgram:
+	void set_pipeline(Scene::Drawable::Pipeline *pipeline) const;
+
+	//send the grid parameters from the last update() to a clustered LitColorTextureProgram:
+	void set_uniforms(LitColorTextureProgram const &program) const;
+
+	//stats from the last update():
+	uint32_t global_lights = 0; //(hemisphere and directional)
+	uint32_t binned_lights = 0; //point and spot lights that touched at least one cluster
+	uint32_t references = 0; //total entries in all cluster lists
+
+	//-- internals ---
+	GLuint lights_buffer = 0, lights_texture = 0;
+	GLuint clusters_buffer = 0, clusters_texture = 0;
+	GLuint indices_buffer = 0, indices_texture = 0;
+
+	glm::vec4 depth_plane = glm::vec4(0.0f); //depth = dot(xyz, position) + w
+	glm::vec2 depth_scale = glm::vec2(0.0f); //slice = log(depth) * x + y
+	glm::vec2 tile_size = glm::vec2(1.0f); //in pixels
+
+	//scratch space (kept so update() doesn't allocate once warmed up):
+	std::vector< glm::vec4 > light_data;
+	struct Bounds { glm::uvec3 min, max; uint32_t light; };
+	std::vector< Bounds > bounds;
+	std::vector< glm::uvec2 > clusters;
+	std::vector< uint16_t > indices;
+};
@@ -0,0 +1,36 @@
+#include "DepthProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+
+Load< DepthProgram > depth_program(LoadTagEarly);
+
+DepthProgram::DepthProgram() {
+	program = gl_compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform mat4 CLIP_FROM_OBJECT;\n"
+		"layout(location = 0) in vec4 Position;\n"
+		"invariant gl_Position;\n" //(matches LitColorTextureProgram exactly, for depth prepasses)
+		"void main() {\n"
+		"	gl_Position = CLIP_FROM_OBJECT * Position;\n"
+		"}\n"
+	,
+		//fragment shader:
+		// (nothing to write but depth)
+		"#version 330\n"
+		"void main() {\n"
+		"}\n"
+	);
+
+	//look up the locations of vertex attributes:
+	Position_vec4 = glGetAttribLocation(program, "Position");
+
+	//look up the locations of uniforms:
+	CLIP_FROM_OBJECT_mat4 = glGetUniformLocation(program, "CLIP_FROM_OBJECT");
+}
+
+DepthProgram::~DepthProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
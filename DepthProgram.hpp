@@ -0,0 +1,21 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+
+//Shader program that draws transformed vertices into the depth buffer only (for shadow maps and depth prepasses):
+// (Position is at location 0, as in LitColorTextureProgram, so the same vertex array objects work with both)
+struct DepthProgram {
+	DepthProgram();
+	~DepthProgram();
+
+	GLuint program = 0;
+	//Attribute (per-vertex variable) locations:
+	GLuint Position_vec4 = -1U;
+	//Uniform (per-invocation variable) locations:
+	GLuint CLIP_FROM_OBJECT_mat4 = -1U;
+	//Textures:
+	// none
+};
+
+extern Load< DepthProgram > depth_program;
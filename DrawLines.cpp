@@ -3,21 +3,39 @@
 #include "ColorProgram.hpp"
 
 #include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
 //All DrawLines instances share a vertex array object and vertex buffer, initialized at load time:
+// each batch is appended to the vertex buffer (which is used as a ring);
+// when it fills up, the buffer is orphaned and the next batch starts at the beginning again.
 
 //n.b. declared static so they don't conflict with similarly named global variables elsewhere:
 static GLuint vertex_buffer = 0;
 static GLuint vertex_buffer_for_color_program = 0;
+static GLsizeiptr vertex_buffer_size = 4 << 20; //bytes of storage (grows if a single batch needs more)
+static GLsizeiptr vertex_buffer_head = 0; //where the next batch goes
+
+//emptied 'attribs' arrays from earlier batches, so new batches can reuse their memory:
+static std::vector< std::vector< DrawLines::Vertex > > spare_attribs;
 
 static Load< void > setup_buffers(LoadTagDefault, [](){
 	//you may recognize this init code from DrawSprites.cpp:
 
 	{ //set up vertex buffer:
 		glGenBuffers(1, &vertex_buffer);
-		//for now, buffer will be un-filled.
+		glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+		glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, nullptr, GL_STREAM_DRAW); //allocate (but don't fill) storage
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
 	{ //vertex array mapping buffer for color_program:
@@ -64,6 +82,10 @@ static Load< void > setup_buffers(LoadTagDefault, [](){
 
 
 DrawLines::DrawLines(glm::mat4 const &world_to_clip_) : world_to_clip(world_to_clip_) {
+	if (!spare_attribs.empty()) {
+		attribs = std::move(spare_attribs.back());
+		spare_attribs.pop_back();
+	}
 }
 
 void DrawLines::draw(glm::vec3 const &a, glm::vec3 const &b, glm::u8vec4 const &color) {
@@ -90,26 +112,26 @@ void DrawLines::draw_box(glm::mat4x3 const &mat, glm::u8vec4 const &color) {
 	draw(mat * glm::vec4( 1.0f, 1.0f,-1.0f, 1.0f), mat * glm::vec4( 1.0f, 1.0f, 1.0f, 1.0f), color);
 }
 
-void DrawLines::draw_text(std::string const &text, glm::vec3 const &anchor_in, glm::vec3 const &x, glm::vec3 const &y, glm::u8vec4 const &color, glm::vec3 *anchor_out) {
-
-	glm::vec3 anchor = anchor_in;
+void DrawLines::draw_text(std::string const &text, glm::vec3 const &anchor, glm::vec3 const &x, glm::vec3 const &y, glm::u8vec4 const &color, glm::vec3 *anchor_out) {
+	//(laid out into a reused run, so only the first call allocates)
+	static TextRun scratch;
+	layout_text(text, &scratch);
+	draw_text_run(scratch, anchor, x, y, color, anchor_out);
+}
 
-	uint32_t start = 0;
-	while (start < text.size()) {
-		uint32_t end = start;
-		uint32_t glyph = -1U;
-		while (end < text.size()) {
-			end += 1;
-			auto f = PathFont::font.glyph_map.find(text.substr(start, end-start));
-			if (f == PathFont::font.glyph_map.end()) {
-				end -= 1;
-				break;
-			}
-			glyph = f->second;
-		}
-		if (glyph == -1U) {
-			assert(start == end);
-			end += 1;
+void DrawLines::layout_text(std::string_view text, TextRun *run_) {
+	assert(run_);
+	auto &run = *run_;
+	run.points.clear();
+	run.advance = 0.0f;
+
+	PathFont const &font = PathFont::font;
+	char const *at = text.data();
+	char const *end = text.data() + text.size();
+	while (at < end) {
+		uint32_t length;
+		uint32_t glyph = font.find_glyph(at, end, &length);
+		if (glyph == PathFont::NoGlyph) {
 			//missing! draw a tofu:
 			for (const auto &pt : {
 				glm::vec2(0.1f, 0.1f), glm::vec2(0.6f, 0.1f),
@@ -117,48 +139,128 @@ void DrawLines::draw_text(std::string const &text, glm::vec3 const &anchor_in, g
 				glm::vec2(0.9f, 0.6f), glm::vec2(0.1f, 0.9f),
 				glm::vec2(0.1f, 0.9f), glm::vec2(0.1f, 0.1f)
 			}) {
-				attribs.emplace_back(anchor + pt.x * x + pt.y * y, color);
+				run.points.emplace_back(run.advance + pt.x, pt.y);
 			}
-			anchor += x * 0.6f;
+			run.advance += 0.6f;
 		} else {
-			for (uint32_t c = PathFont::font.glyph_coord_starts[glyph]; c + 1 < PathFont::font.glyph_coord_starts[glyph+1]; c += 2) {
-				attribs.emplace_back(anchor + x * PathFont::font.coords[c] + y * PathFont::font.coords[c+1], color);
+			for (uint32_t c = font.glyph_coord_starts[glyph]; c + 1 < font.glyph_coord_starts[glyph+1]; c += 2) {
+				run.points.emplace_back(run.advance + font.coords[c], font.coords[c+1]);
 			}
-			anchor += x * PathFont::font.glyph_widths[glyph];
+			run.advance += font.glyph_widths[glyph];
 		}
-		start = end;
+		at += length;
 	}
+}
+
+void DrawLines::draw_text_run(TextRun const &run, glm::vec3 const &anchor, glm::vec3 const &x, glm::vec3 const &y, glm::u8vec4 const &color, glm::vec3 *anchor_out) {
+	attribs.reserve(attribs.size() + run.points.size());
+	for (glm::vec2 const &pt : run.points) {
+		attribs.emplace_back(anchor + pt.x * x + pt.y * y, color);
+	}
+	if (anchor_out) *anchor_out = anchor + run.advance * x;
+}
 
+void DrawLines::draw_cached_text(std::string_view text, glm::vec3 const &anchor, glm::vec3 const &x, glm::vec3 const &y, glm::u8vec4 const &color, glm::vec3 *anchor_out) {
+	//(transparent hash and equality, so find() can take 'text' as-is instead of building a std::string key)
+	struct Hash {
+		using is_transparent = void;
+		size_t operator()(std::string_view str) const { return std::hash< std::string_view >()(str); }
+	};
+	static std::unordered_map< std::string, TextRun, Hash, std::equal_to<> > cache;
+	auto f = cache.find(text);
+	if (f == cache.end()) {
+		if (cache.size() >= 256) cache.clear(); //(a cheap bound, in case the text keeps changing)
+		f = cache.emplace(std::string(text), TextRun()).first;
+		layout_text(text, &f->second);
+	}
+	draw_text_run(f->second, anchor, x, y, color, anchor_out);
+}
+
+void DrawLines::draw_number(int64_t value, glm::vec3 const &anchor_in, glm::vec3 const &x, glm::vec3 const &y, glm::u8vec4 const &color, glm::vec3 *anchor_out) {
+	//runs for '0'-'9' and '-':
+	static std::array< TextRun, 11 > const digits = [](){
+		std::array< TextRun, 11 > ret;
+		for (uint32_t d = 0; d < 10; ++d) {
+			layout_text(std::string(1, char('0' + d)), &ret[d]);
+		}
+		layout_text("-", &ret[10]);
+		return ret;
+	}();
+
+	//digits, least significant first:
+	uint8_t buffer[20];
+	uint32_t count = 0;
+	uint64_t magnitude = (value < 0 ? 0 - uint64_t(value) : uint64_t(value));
+	do {
+		buffer[count++] = uint8_t(magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+
+	glm::vec3 anchor = anchor_in;
+	if (value < 0) draw_text_run(digits[10], anchor, x, y, color, &anchor);
+	while (count > 0) {
+		draw_text_run(digits[buffer[--count]], anchor, x, y, color, &anchor);
+	}
 	if (anchor_out) *anchor_out = anchor;
 }
 
 DrawLines::~DrawLines() {
-	if (attribs.empty()) return;
+	if (!attribs.empty()) submit();
+
+	//hand back the (emptied) vertex memory for the next batch:
+	attribs.clear();
+	if (spare_attribs.size() < 4) spare_attribs.emplace_back(std::move(attribs));
+}
+
+void DrawLines::submit() {
+	GPU_ZONE("DrawLines");
 
 	//based on DrawSprites.cpp :
 
-	//upload vertices to vertex_buffer:
+	//upload vertices to the next free part of vertex_buffer:
+	GLsizeiptr bytes = GLsizeiptr(attribs.size() * sizeof(attribs[0]));
 	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer); //set vertex_buffer as current
-	glBufferData(GL_ARRAY_BUFFER, attribs.size() * sizeof(attribs[0]), attribs.data(), GL_STREAM_DRAW); //upload attribs array
+	if (vertex_buffer_head + bytes > vertex_buffer_size) {
+		//out of room: orphan the storage (the driver hands back fresh memory, so nothing waits on earlier draws) and start over:
+		if (bytes > vertex_buffer_size) vertex_buffer_size = std::max(2 * vertex_buffer_size, bytes);
+		glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, nullptr, GL_STREAM_DRAW);
+		vertex_buffer_head = 0;
+	}
+	//(unsynchronized is safe: no draw has used this range since the storage was orphaned)
+	void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, vertex_buffer_head, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	if (mapped) {
+		std::memcpy(mapped, attribs.data(), bytes);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+	} else {
+		glBufferSubData(GL_ARRAY_BUFFER, vertex_buffer_head, bytes, attribs.data());
+	}
+	PerfStats::count_upload(bytes);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 
+	GLint first = GLint(vertex_buffer_head / GLsizeiptr(sizeof(attribs[0])));
+	vertex_buffer_head += bytes;
+
 	//set color_program as current program:
 	glUseProgram(color_program->program);
 
 	//upload OBJECT_TO_CLIP to the proper uniform location:
 	glUniformMatrix4fv(color_program->OBJECT_TO_CLIP_mat4, 1, GL_FALSE, glm::value_ptr(world_to_clip));
+	PerfStats::count_uniform_uploads();
 
 	//use the mapping vertex_buffer_for_color_program to fetch vertex data:
 	glBindVertexArray(vertex_buffer_for_color_program);
+	PerfStats::count_state_changes(2); //(program + vertex array)
 
 	//run the OpenGL pipeline:
-	glDrawArrays(GL_LINES, 0, GLsizei(attribs.size()));
+	glDrawArrays(GL_LINES, first, GLsizei(attribs.size()));
+	PerfStats::count_draw(GL_LINES, uint32_t(attribs.size()));
 
 	//reset vertex array to none:
 	glBindVertexArray(0);
 
 	//reset current program to none:
 	glUseProgram(0);
+	PerfStats::count_state_changes(2);
 }
 
 
@@ -12,6 +12,7 @@
 #include <glm/glm.hpp>
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 struct DrawLines {
@@ -33,8 +34,44 @@ struct DrawLines {
 		glm::u8vec4 const &color = glm::u8vec4(0xff),
 		glm::vec3 *anchor_out = nullptr);
 
+	//------ retained text ------
+	//text laid out once (in character box units) can be redrawn with just a transform-and-copy:
+	struct TextRun {
+		std::vector< glm::vec2 > points; //line endpoints; point (u,v) is drawn at anchor + u * x + v * y
+		float advance = 0.0f; //how far (in units of x) the anchor moves
+	};
+	static void layout_text(std::string_view text, TextRun *run);
+
+	//draw a run (arguments as per draw_text):
+	void draw_text_run(TextRun const &run,
+		glm::vec3 const &anchor,
+		glm::vec3 const &x = glm::vec3(1.0f, 0.0f, 0.0f),
+		glm::vec3 const &y = glm::vec3(0.0f, 1.0f, 1.0f),
+		glm::u8vec4 const &color = glm::u8vec4(0xff),
+		glm::vec3 *anchor_out = nullptr);
+
+	//draw_text, but laid out once and then kept in a cache keyed by 'text':
+	// (size, position, and color are applied when copying, so they don't need to be part of the key)
+	// (meant for strings that are drawn over and over; the cache is emptied if it gets large)
+	// (looking up text that is already cached doesn't allocate, even when 'text' is a string literal)
+	void draw_cached_text(std::string_view text,
+		glm::vec3 const &anchor,
+		glm::vec3 const &x = glm::vec3(1.0f, 0.0f, 0.0f),
+		glm::vec3 const &y = glm::vec3(0.0f, 1.0f, 1.0f),
+		glm::u8vec4 const &color = glm::u8vec4(0xff),
+		glm::vec3 *anchor_out = nullptr);
+
+	//draw an integer from pre-laid-out digits (for numbers that change every frame; never allocates or lays out):
+	void draw_number(int64_t value,
+		glm::vec3 const &anchor,
+		glm::vec3 const &x = glm::vec3(1.0f, 0.0f, 0.0f),
+		glm::vec3 const &y = glm::vec3(0.0f, 1.0f, 1.0f),
+		glm::u8vec4 const &color = glm::u8vec4(0xff),
+		glm::vec3 *anchor_out = nullptr);
+
 	//Finish drawing (push attribs to GPU):
 	~DrawLines();
+	void submit(); //(does the drawing for the destructor)
 
 
 	glm::mat4 world_to_clip;
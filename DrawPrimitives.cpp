@@ -0,0 +1,221 @@
+#include "DrawPrimitives.hpp"
+#include "InstancedColorProgram.hpp"
+
+#include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cmath>
+
+//All DrawPrimitives instances share one vertex array object, a buffer of unit shapes, and a buffer of instances:
+
+//n.b. declared static so they don't conflict with similarly named global variables elsewhere:
+static GLuint shape_buffer = 0;
+static GLuint instance_buffer = 0;
+static GLuint vertex_array_for_instanced_color_program = 0;
+
+//range of each (GL_LINES) shape in shape_buffer:
+static struct {
+	GLint start = 0;
+	GLsizei count = 0;
+} shapes[DrawPrimitives::ShapeCount];
+
+static Load< void > setup_buffers(LoadTagDefault, [](){
+	{ //build the unit shapes and upload them to shape_buffer:
+		struct Vertex {
+			glm::vec3 Position;
+			float End; //1 for capsules' far end
+		};
+		static_assert(sizeof(Vertex) == 4*3 + 4, "Vertex is packed.");
+		std::vector< Vertex > vertices;
+
+		constexpr uint32_t Segments = 32; //per full circle
+		constexpr float Tau = 6.28318530718f;
+		//part of the unit circle from angle 'begin' to 'end', in the plane spanned by 'x' and 'y':
+		auto arc = [&](glm::vec3 const &x, glm::vec3 const &y, float begin, float end, float End) {
+			uint32_t steps = uint32_t(std::round(Segments * (end - begin) / Tau));
+			for (uint32_t i = 0; i < steps; ++i) {
+				float a0 = begin + (end - begin) * (i / float(steps));
+				float a1 = begin + (end - begin) * ((i + 1) / float(steps));
+				vertices.emplace_back(Vertex{std::cos(a0) * x + std::sin(a0) * y, End});
+				vertices.emplace_back(Vertex{std::cos(a1) * x + std::sin(a1) * y, End});
+			}
+		};
+		glm::vec3 const X(1.0f, 0.0f, 0.0f), Y(0.0f, 1.0f, 0.0f), Z(0.0f, 0.0f, 1.0f);
+
+		//sphere: three great circles
+		shapes[DrawPrimitives::Sphere].start = GLint(vertices.size());
+		arc(X, Y, 0.0f, Tau, 0.0f);
+		arc(Y, Z, 0.0f, Tau, 0.0f);
+		arc(Z, X, 0.0f, Tau, 0.0f);
+		shapes[DrawPrimitives::Sphere].count = GLsizei(vertices.size()) - shapes[DrawPrimitives::Sphere].start;
+
+		//box: the twelve edges of [-1,1]^3
+		shapes[DrawPrimitives::Box].start = GLint(vertices.size());
+		for (uint32_t axis = 0; axis < 3; ++axis) {
+			for (uint32_t corner = 0; corner < 4; ++corner) {
+				glm::vec3 a(0.0f);
+				a[(axis + 1) % 3] = (corner & 1 ? 1.0f : -1.0f);
+				a[(axis + 2) % 3] = (corner & 2 ? 1.0f : -1.0f);
+				glm::vec3 b = a;
+				a[axis] = -1.0f;
+				b[axis] = 1.0f;
+				vertices.emplace_back(Vertex{a, 0.0f});
+				vertices.emplace_back(Vertex{b, 0.0f});
+			}
+		}
+		shapes[DrawPrimitives::Box].count = GLsizei(vertices.size()) - shapes[DrawPrimitives::Box].start;
+
+		//capsule: unit radius around +z; vertices with End = 1 get moved to the far end
+		shapes[DrawPrimitives::Capsule].start = GLint(vertices.size());
+		arc(X, Y, 0.0f, Tau, 0.0f);
+		arc(X, Y, 0.0f, Tau, 1.0f);
+		arc(X, Z, 0.5f * Tau, Tau, 0.0f); //near end cap (z <= 0)
+		arc(Y, Z, 0.5f * Tau, Tau, 0.0f);
+		arc(X, Z, 0.0f, 0.5f * Tau, 1.0f); //far end cap (z >= 0)
+		arc(Y, Z, 0.0f, 0.5f * Tau, 1.0f);
+		for (glm::vec3 const &side : {X, -X, Y, -Y}) {
+			vertices.emplace_back(Vertex{side, 0.0f});
+			vertices.emplace_back(Vertex{side, 1.0f});
+		}
+		shapes[DrawPrimitives::Capsule].count = GLsizei(vertices.size()) - shapes[DrawPrimitives::Capsule].start;
+
+		glGenBuffers(1, &shape_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, shape_buffer);
+		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+		PerfStats::count_upload(vertices.size() * sizeof(Vertex));
+
+		//vertex array: per-vertex attributes come from shape_buffer...
+		glGenVertexArrays(1, &vertex_array_for_instanced_color_program);
+		glBindVertexArray(vertex_array_for_instanced_color_program);
+
+		glVertexAttribPointer(instanced_color_program->Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+		glEnableVertexAttribArray(instanced_color_program->Position_vec4);
+		glVertexAttribPointer(instanced_color_program->End_float, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, End));
+		glEnableVertexAttribArray(instanced_color_program->End_float);
+
+		//...and per-instance attributes from instance_buffer (pointed at each shape's instances when drawing):
+		glGenBuffers(1, &instance_buffer);
+		for (GLuint attrib : {
+			instanced_color_program->WORLD_FROM_LOCAL_ROW0_vec4,
+			instanced_color_program->WORLD_FROM_LOCAL_ROW1_vec4,
+			instanced_color_program->WORLD_FROM_LOCAL_ROW2_vec4,
+			instanced_color_program->Offset_vec4,
+			instanced_color_program->Color_vec4
+		}) {
+			glEnableVertexAttribArray(attrib);
+			glVertexAttribDivisor(attrib, 1);
+		}
+
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	GL_ERRORS(); //PARANOIA: make sure nothing strange happened during setup
+});
+
+
+DrawPrimitives::DrawPrimitives(glm::mat4 const &world_to_clip_) : world_to_clip(world_to_clip_) {
+}
+
+//helper: instance that applies 'mat':
+static DrawPrimitives::Instance make_instance(glm::mat4x3 const &mat, glm::vec3 const &offset, glm::u8vec4 const &color) {
+	DrawPrimitives::Instance instance;
+	for (uint32_t r = 0; r < 3; ++r) {
+		instance.rows[r] = glm::vec4(mat[0][r], mat[1][r], mat[2][r], mat[3][r]);
+	}
+	instance.offset = glm::vec4(offset, 0.0f);
+	instance.color = color;
+	return instance;
+}
+
+void DrawPrimitives::draw_sphere(glm::vec3 const &center, float radius, glm::u8vec4 const &color) {
+	instances[Sphere].emplace_back(make_instance(glm::mat4x3(
+		radius, 0.0f, 0.0f,
+		0.0f, radius, 0.0f,
+		0.0f, 0.0f, radius,
+		center.x, center.y, center.z
+	), glm::vec3(0.0f), color));
+}
+
+void DrawPrimitives::draw_box(glm::mat4x3 const &mat, glm::u8vec4 const &color) {
+	instances[Box].emplace_back(make_instance(mat, glm::vec3(0.0f), color));
+}
+
+void DrawPrimitives::draw_box(glm::vec3 const &min, glm::vec3 const &max, glm::u8vec4 const &color) {
+	glm::vec3 center = 0.5f * (max + min);
+	glm::vec3 radius = 0.5f * (max - min);
+	draw_box(glm::mat4x3(
+		radius.x, 0.0f, 0.0f,
+		0.0f, radius.y, 0.0f,
+		0.0f, 0.0f, radius.z,
+		center.x, center.y, center.z
+	), color);
+}
+
+void DrawPrimitives::draw_capsule(glm::vec3 const &a, glm::vec3 const &b, float radius, glm::u8vec4 const &color) {
+	//local z points from a to b:
+	glm::vec3 z = b - a;
+	float length = glm::length(z);
+	z = (length > 0.0f ? z / length : glm::vec3(0.0f, 0.0f, 1.0f));
+	glm::vec3 x = glm::normalize(glm::cross(z, (std::abs(z.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f))));
+	glm::vec3 y = glm::cross(z, x);
+	instances[Capsule].emplace_back(make_instance(glm::mat4x3(radius * x, radius * y, radius * z, a), b - a, color));
+}
+
+DrawPrimitives::~DrawPrimitives() {
+	submit();
+}
+
+void DrawPrimitives::submit() {
+	size_t total = 0;
+	for (auto const &list : instances) total += list.size();
+	if (total == 0) return;
+
+	GPU_ZONE("DrawPrimitives");
+
+	//upload every shape's instances at once:
+	glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+	glBufferData(GL_ARRAY_BUFFER, total * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+	size_t first[ShapeCount];
+	size_t at = 0;
+	for (uint32_t s = 0; s < ShapeCount; ++s) {
+		first[s] = at;
+		if (instances[s].empty()) continue;
+		glBufferSubData(GL_ARRAY_BUFFER, at * sizeof(Instance), instances[s].size() * sizeof(Instance), instances[s].data());
+		at += instances[s].size();
+	}
+	PerfStats::count_upload(total * sizeof(Instance));
+
+	glUseProgram(instanced_color_program->program);
+	glUniformMatrix4fv(instanced_color_program->CLIP_FROM_WORLD_mat4, 1, GL_FALSE, glm::value_ptr(world_to_clip));
+	PerfStats::count_uniform_uploads();
+
+	glBindVertexArray(vertex_array_for_instanced_color_program);
+	PerfStats::count_state_changes(2); //(program + vertex array)
+
+	//one draw per shape:
+	for (uint32_t s = 0; s < ShapeCount; ++s) {
+		if (instances[s].empty()) continue;
+
+		//point the per-instance attributes at this shape's instances (GL 3.3 has no 'base instance' parameter):
+		GLbyte *base = (GLbyte *)0 + first[s] * sizeof(Instance);
+		glVertexAttribPointer(instanced_color_program->WORLD_FROM_LOCAL_ROW0_vec4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), base + offsetof(Instance, rows[0]));
+		glVertexAttribPointer(instanced_color_program->WORLD_FROM_LOCAL_ROW1_vec4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), base + offsetof(Instance, rows[1]));
+		glVertexAttribPointer(instanced_color_program->WORLD_FROM_LOCAL_ROW2_vec4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), base + offsetof(Instance, rows[2]));
+		glVertexAttribPointer(instanced_color_program->Offset_vec4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), base + offsetof(Instance, offset));
+		glVertexAttribPointer(instanced_color_program->Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), base + offsetof(Instance, color));
+
+		glDrawArraysInstanced(GL_LINES, shapes[s].start, shapes[s].count, GLsizei(instances[s].size()));
+		PerfStats::count_draw(GL_LINES, uint32_t(shapes[s].count * instances[s].size()));
+
+		instances[s].clear();
+	}
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glUseProgram(0);
+	PerfStats::count_state_changes(2);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ * Helper class for drawing lots of wireframe spheres, boxes, and capsules --
+ *  meant for DEBUG visualization (e.g., colliders).
+ *
+ * Same usage pattern as DrawLines: calls just add to per-shape arrays of
+ *  instances (a transform and a color each); the destructor uploads all
+ *  of them at once and draws each shape with one instanced draw call.
+ *
+ */
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <vector>
+
+struct DrawPrimitives {
+	//Start drawing; will remember world_to_clip matrix:
+	DrawPrimitives(glm::mat4 const &world_to_clip);
+
+	//draw a sphere:
+	void draw_sphere(glm::vec3 const &center, float radius, glm::u8vec4 const &color = glm::u8vec4(0xff));
+
+	//draw the [-1,1]^3 cube transformed by mat:
+	void draw_box(glm::mat4x3 const &mat, glm::u8vec4 const &color = glm::u8vec4(0xff));
+	//draw an axis-aligned box:
+	void draw_box(glm::vec3 const &min, glm::vec3 const &max, glm::u8vec4 const &color = glm::u8vec4(0xff));
+
+	//draw the capsule around segment a-b:
+	void draw_capsule(glm::vec3 const &a, glm::vec3 const &b, float radius, glm::u8vec4 const &color = glm::u8vec4(0xff));
+
+	//Finish drawing (push instances to GPU):
+	~DrawPrimitives();
+	void submit(); //(does the drawing for the destructor)
+
+
+	glm::mat4 world_to_clip;
+
+	struct Instance {
+		glm::vec4 rows[3]; //world-from-local transform, as the rows of a 3x4 matrix
+		glm::vec4 offset; //(capsules) far end minus near end; (others) zero
+		glm::u8vec4 color;
+	};
+	static_assert(sizeof(Instance) == 4*4*4 + 4, "Instance is packed.");
+
+	enum Shape : uint32_t {
+		Sphere,
+		Box,
+		Capsule,
+		ShapeCount //<-- just used to track # of shapes
+	};
+	std::array< std::vector< Instance >, ShapeCount > instances;
+};
@@ -0,0 +1,207 @@
+#include "DrawSDFText.hpp"
+#include "PathFont.hpp"
+#include "SDFTextProgram.hpp"
+
+#include "data_path.hpp"
+#include "load_save_png.hpp"
+#include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+//All DrawSDFText instances share the atlas texture, a vertex array object, a vertex buffer, and an index buffer:
+// the vertex buffer is used as a ring, just like in DrawLines.cpp;
+// the index buffer holds the (0,1,2, 0,2,3) pattern for as many quads as the largest batch so far.
+
+//n.b. declared static so they don't conflict with similarly named global variables elsewhere:
+static GLuint atlas_texture = 0;
+static glm::vec2 cell_texcoords = glm::vec2(0.0f); //size of one glyph's cell in the atlas, in texture coordinates
+
+static GLuint vertex_buffer = 0;
+static GLuint index_buffer = 0;
+static GLuint vertex_buffer_for_sdf_text_program = 0;
+static GLsizeiptr vertex_buffer_size = 4 << 20; //bytes of storage (grows if a single batch needs more)
+static GLsizeiptr vertex_buffer_head = 0; //where the next batch goes
+static uint32_t index_buffer_quads = 0; //quads covered by index_buffer
+
+static std::vector< std::vector< DrawSDFText::Vertex > > spare_attribs;
+
+static Load< void > setup_atlas(LoadTagDefault, [](){
+	PathFont::SDF const &sdf = PathFont::font.sdf;
+	if (!sdf.atlas || sdf.columns == 0) {
+		throw std::runtime_error("PathFont has no distance field atlas (re-run make-PathFont-font.py).");
+	}
+
+	glm::uvec2 size;
+	std::vector< glm::u8vec4 > data;
+	load_png(data_path(sdf.atlas), &size, &data, LowerLeftOrigin);
+
+	//cells are laid out in a grid, 'columns' wide, with the same aspect ratio as [cell_min,cell_max]:
+	glm::vec2 cell = glm::vec2(sdf.cell_max[0] - sdf.cell_min[0], sdf.cell_max[1] - sdf.cell_min[1]);
+	float cell_pixels = float(size.x) / float(sdf.columns);
+	cell_texcoords = glm::vec2(1.0f / float(sdf.columns), cell_pixels * (cell.y / cell.x) / float(size.y));
+
+	glGenTextures(1, &atlas_texture);
+	glBindTexture(GL_TEXTURE_2D, atlas_texture);
+	//(only the red channel is kept; the atlas is grayscale)
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+	glGenerateMipmap(GL_TEXTURE_2D);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	GL_ERRORS();
+});
+
+static Load< void > setup_buffers(LoadTagDefault, [](){
+	glGenBuffers(1, &vertex_buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+	glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, nullptr, GL_STREAM_DRAW);
+
+	glGenBuffers(1, &index_buffer);
+
+	glGenVertexArrays(1, &vertex_buffer_for_sdf_text_program);
+	glBindVertexArray(vertex_buffer_for_sdf_text_program);
+
+	glVertexAttribPointer(sdf_text_program->Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(DrawSDFText::Vertex), (GLbyte *)0 + offsetof(DrawSDFText::Vertex, Position));
+	glEnableVertexAttribArray(sdf_text_program->Position_vec4);
+
+	glVertexAttribPointer(sdf_text_program->TexCoord_vec2, 2, GL_FLOAT, GL_FALSE, sizeof(DrawSDFText::Vertex), (GLbyte *)0 + offsetof(DrawSDFText::Vertex, TexCoord));
+	glEnableVertexAttribArray(sdf_text_program->TexCoord_vec2);
+
+	glVertexAttribPointer(sdf_text_program->Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(DrawSDFText::Vertex), (GLbyte *)0 + offsetof(DrawSDFText::Vertex, Color));
+	glEnableVertexAttribArray(sdf_text_program->Color_vec4);
+
+	//(the element array binding is part of the vertex array object's state)
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	GL_ERRORS();
+});
+
+DrawSDFText::DrawSDFText(glm::mat4 const &world_to_clip_) : world_to_clip(world_to_clip_) {
+	if (!spare_attribs.empty()) {
+		attribs = std::move(spare_attribs.back());
+		spare_attribs.pop_back();
+	}
+}
+
+void DrawSDFText::draw_text(std::string const &text, glm::vec3 const &anchor, glm::vec3 const &x, glm::vec3 const &y, glm::u8vec4 const &color, glm::vec3 *anchor_out) {
+	PathFont const &font = PathFont::font;
+	glm::vec2 cell_min = glm::vec2(font.sdf.cell_min[0], font.sdf.cell_min[1]);
+	glm::vec2 cell_max = glm::vec2(font.sdf.cell_max[0], font.sdf.cell_max[1]);
+
+	//corners of every glyph's quad, relative to its anchor:
+	glm::vec3 const corners[4] = {
+		cell_min.x * x + cell_min.y * y,
+		cell_max.x * x + cell_min.y * y,
+		cell_max.x * x + cell_max.y * y,
+		cell_min.x * x + cell_max.y * y,
+	};
+
+	attribs.reserve(attribs.size() + 4 * text.size());
+
+	float advance = 0.0f;
+	char const *at = text.data();
+	char const *end = text.data() + text.size();
+	while (at < end) {
+		uint32_t length;
+		uint32_t glyph = font.find_glyph(at, end, &length);
+		if (glyph == PathFont::NoGlyph) {
+			//missing! (leave a gap)
+			advance += 0.6f;
+		} else {
+			glm::vec3 origin = anchor + advance * x;
+			glm::vec2 tc = glm::vec2(float(glyph % font.sdf.columns), float(glyph / font.sdf.columns)) * cell_texcoords;
+			attribs.emplace_back(origin + corners[0], tc, color);
+			attribs.emplace_back(origin + corners[1], glm::vec2(tc.x + cell_texcoords.x, tc.y), color);
+			attribs.emplace_back(origin + corners[2], tc + cell_texcoords, color);
+			attribs.emplace_back(origin + corners[3], glm::vec2(tc.x, tc.y + cell_texcoords.y), color);
+			advance += font.glyph_widths[glyph];
+		}
+		at += length;
+	}
+	if (anchor_out) *anchor_out = anchor + advance * x;
+}
+
+DrawSDFText::~DrawSDFText() {
+	if (!attribs.empty()) submit();
+
+	attribs.clear();
+	if (spare_attribs.size() < 4) spare_attribs.emplace_back(std::move(attribs));
+}
+
+void DrawSDFText::submit() {
+	GPU_ZONE("DrawSDFText");
+
+	uint32_t quads = uint32_t(attribs.size() / 4);
+
+	glBindVertexArray(vertex_buffer_for_sdf_text_program);
+
+	if (quads > index_buffer_quads) {
+		//grow the shared index buffer (rarely -- only when a batch is bigger than any before it):
+		index_buffer_quads = std::max(quads, 2 * index_buffer_quads);
+		std::vector< uint32_t > indices;
+		indices.reserve(6 * size_t(index_buffer_quads));
+		for (uint32_t q = 0; q < index_buffer_quads; ++q) {
+			for (uint32_t i : {0, 1, 2, 0, 2, 3}) indices.emplace_back(4 * q + i);
+		}
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(indices[0]), indices.data(), GL_STATIC_DRAW);
+		PerfStats::count_upload(indices.size() * sizeof(indices[0]));
+	}
+
+	//upload vertices to the next free part of vertex_buffer (as in DrawLines::submit):
+	GLsizeiptr bytes = GLsizeiptr(attribs.size() * sizeof(attribs[0]));
+	glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+	if (vertex_buffer_head + bytes > vertex_buffer_size) {
+		if (bytes > vertex_buffer_size) vertex_buffer_size = std::max(2 * vertex_buffer_size, bytes);
+		glBufferData(GL_ARRAY_BUFFER, vertex_buffer_size, nullptr, GL_STREAM_DRAW);
+		vertex_buffer_head = 0;
+	}
+	void *mapped = glMapBufferRange(GL_ARRAY_BUFFER, vertex_buffer_head, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	if (mapped) {
+		std::memcpy(mapped, attribs.data(), bytes);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+	} else {
+		glBufferSubData(GL_ARRAY_BUFFER, vertex_buffer_head, bytes, attribs.data());
+	}
+	PerfStats::count_upload(bytes);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	GLint first = GLint(vertex_buffer_head / GLsizeiptr(sizeof(attribs[0])));
+	vertex_buffer_head += bytes;
+
+	glUseProgram(sdf_text_program->program);
+	glUniformMatrix4fv(sdf_text_program->CLIP_FROM_WORLD_mat4, 1, GL_FALSE, glm::value_ptr(world_to_clip));
+	glUniform1f(sdf_text_program->RANGE_float, PathFont::font.sdf.range);
+	glUniform1f(sdf_text_program->WEIGHT_float, std::min(weight, PathFont::font.sdf.range));
+	PerfStats::count_uniform_uploads(3);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, atlas_texture);
+
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glDepthMask(GL_FALSE);
+	PerfStats::count_state_changes(6); //(vertex array + program + texture + blend + blend func + depth mask)
+
+	//every glyph in the batch, in one draw:
+	glDrawElementsBaseVertex(GL_TRIANGLES, GLsizei(6 * quads), GL_UNSIGNED_INT, nullptr, first);
+	PerfStats::count_draw(GL_TRIANGLES, 6 * quads);
+
+	glDepthMask(GL_TRUE);
+	glDisable(GL_BLEND);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+	glBindVertexArray(0);
+	PerfStats::count_state_changes(5);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ * Helper class for drawing lots of text as textured quads -- e.g., labels,
+ *  scoreboards, and profiler readouts.
+ *
+ * Same usage pattern as DrawLines, but glyphs are sampled from PathFont's
+ *  distance field atlas (made offline by make-PathFont-font.py), so each
+ *  glyph is just four vertices, text stays sharp at any size, and every
+ *  string in a batch is drawn with one draw call.
+ *
+ * Text is alpha-blended (so draw it after opaque geometry) and doesn't
+ *  write depth.
+ *
+ */
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+
+struct DrawSDFText {
+	//Start drawing; will remember world_to_clip matrix:
+	DrawSDFText(glm::mat4 const &world_to_clip);
+
+	//draw text, start at anchor, move in x direction, y gives the up direction:
+	// (default character box is 1 unit high; arguments as per DrawLines::draw_text)
+	void draw_text(std::string const &text,
+		glm::vec3 const &anchor,
+		glm::vec3 const &x = glm::vec3(1.0f, 0.0f, 0.0f),
+		glm::vec3 const &y = glm::vec3(0.0f, 1.0f, 1.0f),
+		glm::u8vec4 const &color = glm::u8vec4(0xff),
+		glm::vec3 *anchor_out = nullptr);
+
+	//half the stroke width of every glyph in the batch, in character box units:
+	// (at most PathFont::font.sdf.range)
+	float weight = 0.06f;
+
+	//Finish drawing (push attribs to GPU):
+	~DrawSDFText();
+	void submit(); //(does the drawing for the destructor)
+
+
+	glm::mat4 world_to_clip;
+	struct Vertex {
+		Vertex(glm::vec3 const &Position_, glm::vec2 const &TexCoord_, glm::u8vec4 const &Color_) : Position(Position_), TexCoord(TexCoord_), Color(Color_) { }
+		glm::vec3 Position;
+		glm::vec2 TexCoord;
+		glm::u8vec4 Color;
+	};
+	static_assert(sizeof(Vertex) == 4*3 + 4*2 + 4, "Vertex is packed.");
+	std::vector< Vertex > attribs; //four per glyph, counterclockwise from the lower left
+
+};
@@ -0,0 +1,117 @@
+#include "DynamicResolution.hpp"
+#include "UpscaleProgram.hpp"
+
+#include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+DynamicResolution::DynamicResolution() {
+	glGenTextures(1, &color);
+	glGenRenderbuffers(1, &depth);
+	glGenFramebuffers(1, &framebuffer);
+	glGenVertexArrays(1, &empty_vao);
+	GL_ERRORS();
+}
+
+DynamicResolution::~DynamicResolution() {
+	glDeleteVertexArrays(1, &empty_vao);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteRenderbuffers(1, &depth);
+	glDeleteTextures(1, &color);
+}
+
+void DynamicResolution::update_scale() {
+	if (!enabled) {
+		scale = max_scale;
+		return;
+	}
+
+	float gpu_ms = 0.0f;
+	for (auto const &section : GPUTimer::results()) {
+		gpu_ms += section.ms;
+	}
+	if (gpu_ms <= 0.0f) return; //nothing timed (yet)
+
+	//results() repeats when a frame goes untimed, so smooth rather than trusting any one frame:
+	if (measured_ms == 0.0f) measured_ms = gpu_ms;
+	else measured_ms += 0.1f * (gpu_ms - measured_ms);
+
+	//dead band, so scale settles rather than hunting:
+	if (measured_ms > 0.95f * target_ms && measured_ms < 1.05f * target_ms) return;
+
+	float wanted = scale * std::sqrt(target_ms / measured_ms);
+	//go down quickly (dropping frames is worse than blur), come back up slowly:
+	float rate = (wanted < scale ? 0.2f : 0.05f);
+	scale = std::clamp(scale + rate * (wanted - scale), min_scale, max_scale);
+}
+
+glm::uvec2 DynamicResolution::begin(glm::uvec2 const &drawable_size) {
+	//(re)allocate at full size when the drawable changes:
+	if (size != drawable_size) {
+		size = drawable_size;
+		glBindTexture(GL_TEXTURE_2D, color);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB8_ALPHA8, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, depth);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size.x, size.y);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+			throw std::runtime_error("Dynamic resolution framebuffer is incomplete.");
+		}
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		GL_ERRORS();
+	}
+
+	update_scale();
+
+	//round to whole pixels (never below one):
+	render_size = glm::max(glm::uvec2(glm::round(glm::vec2(size) * scale)), glm::uvec2(1));
+	render_size = glm::min(render_size, size);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glViewport(0, 0, render_size.x, render_size.y);
+	PerfStats::count_state_changes();
+
+	return render_size;
+}
+
+void DynamicResolution::end(glm::uvec2 const &drawable_size) {
+	GPU_ZONE("DynamicResolution::end");
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glViewport(0, 0, drawable_size.x, drawable_size.y);
+
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_BLEND);
+
+	glUseProgram(upscale_program->program);
+	glUniform2f(upscale_program->TEX_SCALE_vec2, float(render_size.x) / float(size.x), float(render_size.y) / float(size.y));
+	glUniform2f(upscale_program->TEXEL_vec2, 1.0f / float(size.x), 1.0f / float(size.y));
+	//(no point sharpening a copy)
+	glUniform1f(upscale_program->SHARPEN_float, (render_size == size ? 0.0f : sharpen));
+	PerfStats::count_uniform_uploads(3);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, color);
+	glBindVertexArray(empty_vao);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	PerfStats::count_draw(GL_TRIANGLES, 3);
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+
+	GL_ERRORS();
+}
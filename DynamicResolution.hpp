@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+ * DynamicResolution renders a pass into an offscreen target whose size
+ *  follows how long the GPU is taking, then stretches it over the screen:
+ *
+ * //every frame:
+ * glm::uvec2 render_size = dynamic_resolution.begin(drawable_size);
+ * ... draw the 3D scene (viewport is render_size) ...
+ * dynamic_resolution.end(drawable_size); //(back to the default framebuffer)
+ * ... draw text / HUD at full resolution ...
+ *
+ * The target is allocated at the full drawable size and only a corner of it
+ *  (render_size) is drawn into, so changing scale never reallocates.
+ *  Each begin() compares the GPU time of the most recent timed frame (the
+ *  sum of GPUTimer::results()) against target_ms and nudges scale toward
+ *  the value that would fit: cost is roughly proportional to pixel count,
+ *  so to scale^2. A dead band keeps the scale from wandering when the frame
+ *  is near budget. If GPU timing is unavailable, scale stays put.
+ *
+ * end() upscales with bilinear filtering plus a little sharpening
+ *  (UpscaleProgram); at scale 1 it is a plain copy.
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+struct DynamicResolution {
+	DynamicResolution();
+	~DynamicResolution();
+	DynamicResolution(DynamicResolution const &) = delete;
+	DynamicResolution &operator=(DynamicResolution const &) = delete;
+
+	//settings:
+	bool enabled = true; //if false, scale is held at max_scale
+	float target_ms = 12.0f; //GPU time budget per frame
+	float min_scale = 0.5f; //per axis
+	float max_scale = 1.0f;
+	float sharpen = 0.15f; //strength of the upscale's sharpening
+
+	//current state:
+	float scale = 1.0f; //render size / drawable size (per axis)
+	float measured_ms = 0.0f; //smoothed GPU time per frame
+
+	//bind the offscreen target and set the viewport (returns the size being rendered):
+	glm::uvec2 begin(glm::uvec2 const &drawable_size);
+	//upscale into the default framebuffer and restore the viewport:
+	void end(glm::uvec2 const &drawable_size);
+
+	//-- internals ---
+	void update_scale();
+
+	glm::uvec2 size = glm::uvec2(0); //allocated target size
+	glm::uvec2 render_size = glm::uvec2(0); //part of the target drawn this frame
+	GLuint color = 0; //SRGB8_ALPHA8 texture
+	GLuint depth = 0; //renderbuffer
+	GLuint framebuffer = 0;
+	GLuint empty_vao = 0; //(core profile needs some vertex array bound to draw)
+};
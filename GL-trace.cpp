@@ -0,0 +1,1805 @@
+//Wrappers for GL-trace.hpp. This file has been automatically generated by make-GL.py
+#ifdef GL_TRACE
+
+#define GL_TRACE_IMPLEMENTATION
+#include "GL.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ostream>
+
+namespace {
+	constexpr uint32_t Functions = 345;
+
+	constexpr std::array< char const *, Functions > names = {
+		"glCullFace",
+		"glFrontFace",
+		"glHint",
+		"glLineWidth",
+		"glPointSize",
+		"glPolygonMode",
+		"glScissor",
+		"glTexParameterf",
+		"glTexParameterfv",
+		"glTexParameteri",
+		"glTexParameteriv",
+		"glTexImage1D",
+		"glTexImage2D",
+		"glDrawBuffer",
+		"glClear",
+		"glClearColor",
+		"glClearStencil",
+		"glClearDepth",
+		"glStencilMask",
+		"glColorMask",
+		"glDepthMask",
+		"glDisable",
+		"glEnable",
+		"glFinish",
+		"glFlush",
+		"glBlendFunc",
+		"glLogicOp",
+		"glStencilFunc",
+		"glStencilOp",
+		"glDepthFunc",
+		"glPixelStoref",
+		"glPixelStorei",
+		"glReadBuffer",
+		"glReadPixels",
+		"glGetBooleanv",
+		"glGetDoublev",
+		"glGetError",
+		"glGetFloatv",
+		"glGetIntegerv",
+		"glGetString",
+		"glGetTexImage",
+		"glGetTexParameterfv",
+		"glGetTexParameteriv",
+		"glGetTexLevelParameterfv",
+		"glGetTexLevelParameteriv",
+		"glIsEnabled",
+		"glDepthRange",
+		"glViewport",
+		"glDrawArrays",
+		"glDrawElements",
+		"glGetPointerv",
+		"glPolygonOffset",
+		"glCopyTexImage1D",
+		"glCopyTexImage2D",
+		"glCopyTexSubImage1D",
+		"glCopyTexSubImage2D",
+		"glTexSubImage1D",
+		"glTexSubImage2D",
+		"glBindTexture",
+		"glDeleteTextures",
+		"glGenTextures",
+		"glIsTexture",
+		"glDrawRangeElements",
+		"glTexImage3D",
+		"glTexSubImage3D",
+		"glCopyTexSubImage3D",
+		"glActiveTexture",
+		"glSampleCoverage",
+		"glCompressedTexImage3D",
+		"glCompressedTexImage2D",
+		"glCompressedTexImage1D",
+		"glCompressedTexSubImage3D",
+		"glCompressedTexSubImage2D",
+		"glCompressedTexSubImage1D",
+		"glGetCompressedTexImage",
+		"glBlendFuncSeparate",
+		"glMultiDrawArrays",
+		"glMultiDrawElements",
+		"glPointParameterf",
+		"glPointParameterfv",
+		"glPointParameteri",
+		"glPointParameteriv",
+		"glBlendColor",
+		"glBlendEquation",
+		"glGenQueries",
+		"glDeleteQueries",
+		"glIsQuery",
+		"glBeginQuery",
+		"glEndQuery",
+		"glGetQueryiv",
+		"glGetQueryObjectiv",
+		"glGetQueryObjectuiv",
+		"glBindBuffer",
+		"glDeleteBuffers",
+		"glGenBuffers",
+		"glIsBuffer",
+		"glBufferData",
+		"glBufferSubData",
+		"glGetBufferSubData",
+		"glMapBuffer",
+		"glUnmapBuffer",
+		"glGetBufferParameteriv",
+		"glGetBufferPointerv",
+		"glBlendEquationSeparate",
+		"glDrawBuffers",
+		"glStencilOpSeparate",
+		"glStencilFuncSeparate",
+		"glStencilMaskSeparate",
+		"glAttachShader",
+		"glBindAttribLocation",
+		"glCompileShader",
+		"glCreateProgram",
+		"glCreateShader",
+		"glDeleteProgram",
+		"glDeleteShader",
+		"glDetachShader",
+		"glDisableVertexAttribArray",
+		"glEnableVertexAttribArray",
+		"glGetActiveAttrib",
+		"glGetActiveUniform",
+		"glGetAttachedShaders",
+		"glGetAttribLocation",
+		"glGetProgramiv",
+		"glGetProgramInfoLog",
+		"glGetShaderiv",
+		"glGetShaderInfoLog",
+		"glGetShaderSource",
+		"glGetUniformLocation",
+		"glGetUniformfv",
+		"glGetUniformiv",
+		"glGetVertexAttribdv",
+		"glGetVertexAttribfv",
+		"glGetVertexAttribiv",
+		"glGetVertexAttribPointerv",
+		"glIsProgram",
+		"glIsShader",
+		"glLinkProgram",
+		"glShaderSource",
+		"glUseProgram",
+		"glUniform1f",
+		"glUniform2f",
+		"glUniform3f",
+		"glUniform4f",
+		"glUniform1i",
+		"glUniform2i",
+		"glUniform3i",
+		"glUniform4i",
+		"glUniform1fv",
+		"glUniform2fv",
+		"glUniform3fv",
+		"glUniform4fv",
+		"glUniform1iv",
+		"glUniform2iv",
+		"glUniform3iv",
+		"glUniform4iv",
+		"glUniformMatrix2fv",
+		"glUniformMatrix3fv",
+		"glUniformMatrix4fv",
+		"glValidateProgram",
+		"glVertexAttrib1d",
+		"glVertexAttrib1dv",
+		"glVertexAttrib1f",
+		"glVertexAttrib1fv",
+		"glVertexAttrib1s",
+		"glVertexAttrib1sv",
+		"glVertexAttrib2d",
+		"glVertexAttrib2dv",
+		"glVertexAttrib2f",
+		"glVertexAttrib2fv",
+		"glVertexAttrib2s",
+		"glVertexAttrib2sv",
+		"glVertexAttrib3d",
+		"glVertexAttrib3dv",
+		"glVertexAttrib3f",
+		"glVertexAttrib3fv",
+		"glVertexAttrib3s",
+		"glVertexAttrib3sv",
+		"glVertexAttrib4Nbv",
+		"glVertexAttrib4Niv",
+		"glVertexAttrib4Nsv",
+		"glVertexAttrib4Nub",
+		"glVertexAttrib4Nubv",
+		"glVertexAttrib4Nuiv",
+		"glVertexAttrib4Nusv",
+		"glVertexAttrib4bv",
+		"glVertexAttrib4d",
+		"glVertexAttrib4dv",
+		"glVertexAttrib4f",
+		"glVertexAttrib4fv",
+		"glVertexAttrib4iv",
+		"glVertexAttrib4s",
+		"glVertexAttrib4sv",
+		"glVertexAttrib4ubv",
+		"glVertexAttrib4uiv",
+		"glVertexAttrib4usv",
+		"glVertexAttribPointer",
+		"glUniformMatrix2x3fv",
+		"glUniformMatrix3x2fv",
+		"glUniformMatrix2x4fv",
+		"glUniformMatrix4x2fv",
+		"glUniformMatrix3x4fv",
+		"glUniformMatrix4x3fv",
+		"glColorMaski",
+		"glGetBooleani_v",
+		"glGetIntegeri_v",
+		"glEnablei",
+		"glDisablei",
+		"glIsEnabledi",
+		"glBeginTransformFeedback",
+		"glEndTransformFeedback",
+		"glBindBufferRange",
+		"glBindBufferBase",
+		"glTransformFeedbackVaryings",
+		"glGetTransformFeedbackVarying",
+		"glClampColor",
+		"glBeginConditionalRender",
+		"glEndConditionalRender",
+		"glVertexAttribIPointer",
+		"glGetVertexAttribIiv",
+		"glGetVertexAttribIuiv",
+		"glVertexAttribI1i",
+		"glVertexAttribI2i",
+		"glVertexAttribI3i",
+		"glVertexAttribI4i",
+		"glVertexAttribI1ui",
+		"glVertexAttribI2ui",
+		"glVertexAttribI3ui",
+		"glVertexAttribI4ui",
+		"glVertexAttribI1iv",
+		"glVertexAttribI2iv",
+		"glVertexAttribI3iv",
+		"glVertexAttribI4iv",
+		"glVertexAttribI1uiv",
+		"glVertexAttribI2uiv",
+		"glVertexAttribI3uiv",
+		"glVertexAttribI4uiv",
+		"glVertexAttribI4bv",
+		"glVertexAttribI4sv",
+		"glVertexAttribI4ubv",
+		"glVertexAttribI4usv",
+		"glGetUniformuiv",
+		"glBindFragDataLocation",
+		"glGetFragDataLocation",
+		"glUniform1ui",
+		"glUniform2ui",
+		"glUniform3ui",
+		"glUniform4ui",
+		"glUniform1uiv",
+		"glUniform2uiv",
+		"glUniform3uiv",
+		"glUniform4uiv",
+		"glTexParameterIiv",
+		"glTexParameterIuiv",
+		"glGetTexParameterIiv",
+		"glGetTexParameterIuiv",
+		"glClearBufferiv",
+		"glClearBufferuiv",
+		"glClearBufferfv",
+		"glClearBufferfi",
+		"glGetStringi",
+		"glIsRenderbuffer",
+		"glBindRenderbuffer",
+		"glDeleteRenderbuffers",
+		"glGenRenderbuffers",
+		"glRenderbufferStorage",
+		"glGetRenderbufferParameteriv",
+		"glIsFramebuffer",
+		"glBindFramebuffer",
+		"glDeleteFramebuffers",
+		"glGenFramebuffers",
+		"glCheckFramebufferStatus",
+		"glFramebufferTexture1D",
+		"glFramebufferTexture2D",
+		"glFramebufferTexture3D",
+		"glFramebufferRenderbuffer",
+		"glGetFramebufferAttachmentParameteriv",
+		"glGenerateMipmap",
+		"glBlitFramebuffer",
+		"glRenderbufferStorageMultisample",
+		"glFramebufferTextureLayer",
+		"glMapBufferRange",
+		"glFlushMappedBufferRange",
+		"glBindVertexArray",
+		"glDeleteVertexArrays",
+		"glGenVertexArrays",
+		"glIsVertexArray",
+		"glDrawArraysInstanced",
+		"glDrawElementsInstanced",
+		"glTexBuffer",
+		"glPrimitiveRestartIndex",
+		"glCopyBufferSubData",
+		"glGetUniformIndices",
+		"glGetActiveUniformsiv",
+		"glGetActiveUniformName",
+		"glGetUniformBlockIndex",
+		"glGetActiveUniformBlockiv",
+		"glGetActiveUniformBlockName",
+		"glUniformBlockBinding",
+		"glDrawElementsBaseVertex",
+		"glDrawRangeElementsBaseVertex",
+		"glDrawElementsInstancedBaseVertex",
+		"glMultiDrawElementsBaseVertex",
+		"glProvokingVertex",
+		"glFenceSync",
+		"glIsSync",
+		"glDeleteSync",
+		"glClientWaitSync",
+		"glWaitSync",
+		"glGetInteger64v",
+		"glGetSynciv",
+		"glGetInteger64i_v",
+		"glGetBufferParameteri64v",
+		"glFramebufferTexture",
+		"glTexImage2DMultisample",
+		"glTexImage3DMultisample",
+		"glGetMultisamplefv",
+		"glSampleMaski",
+		"glBindFragDataLocationIndexed",
+		"glGetFragDataIndex",
+		"glGenSamplers",
+		"glDeleteSamplers",
+		"glIsSampler",
+		"glBindSampler",
+		"glSamplerParameteri",
+		"glSamplerParameteriv",
+		"glSamplerParameterf",
+		"glSamplerParameterfv",
+		"glSamplerParameterIiv",
+		"glSamplerParameterIuiv",
+		"glGetSamplerParameteriv",
+		"glGetSamplerParameterIiv",
+		"glGetSamplerParameterfv",
+		"glGetSamplerParameterIuiv",
+		"glQueryCounter",
+		"glGetQueryObjecti64v",
+		"glGetQueryObjectui64v",
+		"glVertexAttribDivisor",
+		"glVertexAttribP1ui",
+		"glVertexAttribP1uiv",
+		"glVertexAttribP2ui",
+		"glVertexAttribP2uiv",
+		"glVertexAttribP3ui",
+		"glVertexAttribP3uiv",
+		"glVertexAttribP4ui",
+		"glVertexAttribP4uiv"
+	};
+
+	std::array< uint64_t, Functions > calls{}; //this frame
+	std::array< uint64_t, Functions > ns{};
+	std::array< GLTrace::Stat, Functions > last_frame{};
+
+	uint64_t now_ns() {
+		return uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	//counts (and maybe times) one call over its lifetime:
+	struct Call {
+		Call(uint32_t index_) : index(index_), begin_ns(GLTrace::timing ? now_ns() : 0) {
+			calls[index] += 1;
+		}
+		~Call() {
+			if (begin_ns) ns[index] += now_ns() - begin_ns;
+		}
+		uint32_t index;
+		uint64_t begin_ns;
+	};
+
+	std::vector< GLTrace::Stat > sorted_last_frame() {
+		std::vector< GLTrace::Stat > stats;
+		for (GLTrace::Stat const &stat : last_frame) {
+			if (stat.calls) stats.emplace_back(stat);
+		}
+		std::stable_sort(stats.begin(), stats.end(), [](GLTrace::Stat const &a, GLTrace::Stat const &b){
+			return a.calls > b.calls;
+		});
+		return stats;
+	}
+}
+
+bool GLTrace::timing = false;
+
+void GLTrace::end_frame() {
+	for (uint32_t i = 0; i < Functions; ++i) {
+		last_frame[i] = Stat{names[i], calls[i], ns[i]};
+	}
+	calls.fill(0);
+	ns.fill(0);
+}
+
+std::vector< GLTrace::Stat > GLTrace::hottest(uint32_t count) {
+	std::vector< Stat > stats = sorted_last_frame();
+	if (stats.size() > count) stats.resize(count);
+	return stats;
+}
+
+void GLTrace::report(std::ostream &out) {
+	std::vector< Stat > stats = sorted_last_frame();
+	uint64_t total = 0;
+	for (Stat const &stat : stats) total += stat.calls;
+	out << "GL calls last frame: " << total << "\n";
+	for (Stat const &stat : stats) {
+		out << "  " << stat.calls << "\t" << stat.name;
+		if (timing) out << "\t" << double(stat.ns) * 1e-6 << "ms";
+		out << "\n";
+	}
+	out.flush();
+}
+
+void gl_trace_glCullFace(GLenum mode) {
+	Call c(0);
+	glCullFace(mode);
+}
+void gl_trace_glFrontFace(GLenum mode) {
+	Call c(1);
+	glFrontFace(mode);
+}
+void gl_trace_glHint(GLenum target, GLenum mode) {
+	Call c(2);
+	glHint(target, mode);
+}
+void gl_trace_glLineWidth(GLfloat width) {
+	Call c(3);
+	glLineWidth(width);
+}
+void gl_trace_glPointSize(GLfloat size) {
+	Call c(4);
+	glPointSize(size);
+}
+void gl_trace_glPolygonMode(GLenum face, GLenum mode) {
+	Call c(5);
+	glPolygonMode(face, mode);
+}
+void gl_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	Call c(6);
+	glScissor(x, y, width, height);
+}
+void gl_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	Call c(7);
+	glTexParameterf(target, pname, param);
+}
+void gl_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	Call c(8);
+	glTexParameterfv(target, pname, params);
+}
+void gl_trace_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	Call c(9);
+	glTexParameteri(target, pname, param);
+}
+void gl_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	Call c(10);
+	glTexParameteriv(target, pname, params);
+}
+void gl_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	Call c(11);
+	glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+void gl_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	Call c(12);
+	glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+void gl_trace_glDrawBuffer(GLenum buf) {
+	Call c(13);
+	glDrawBuffer(buf);
+}
+void gl_trace_glClear(GLbitfield mask) {
+	Call c(14);
+	glClear(mask);
+}
+void gl_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	Call c(15);
+	glClearColor(red, green, blue, alpha);
+}
+void gl_trace_glClearStencil(GLint s) {
+	Call c(16);
+	glClearStencil(s);
+}
+void gl_trace_glClearDepth(GLdouble depth) {
+	Call c(17);
+	glClearDepth(depth);
+}
+void gl_trace_glStencilMask(GLuint mask) {
+	Call c(18);
+	glStencilMask(mask);
+}
+void gl_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	Call c(19);
+	glColorMask(red, green, blue, alpha);
+}
+void gl_trace_glDepthMask(GLboolean flag) {
+	Call c(20);
+	glDepthMask(flag);
+}
+void gl_trace_glDisable(GLenum cap) {
+	Call c(21);
+	glDisable(cap);
+}
+void gl_trace_glEnable(GLenum cap) {
+	Call c(22);
+	glEnable(cap);
+}
+void gl_trace_glFinish(void) {
+	Call c(23);
+	glFinish();
+}
+void gl_trace_glFlush(void) {
+	Call c(24);
+	glFlush();
+}
+void gl_trace_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	Call c(25);
+	glBlendFunc(sfactor, dfactor);
+}
+void gl_trace_glLogicOp(GLenum opcode) {
+	Call c(26);
+	glLogicOp(opcode);
+}
+void gl_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	Call c(27);
+	glStencilFunc(func, ref, mask);
+}
+void gl_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	Call c(28);
+	glStencilOp(fail, zfail, zpass);
+}
+void gl_trace_glDepthFunc(GLenum func) {
+	Call c(29);
+	glDepthFunc(func);
+}
+void gl_trace_glPixelStoref(GLenum pname, GLfloat param) {
+	Call c(30);
+	glPixelStoref(pname, param);
+}
+void gl_trace_glPixelStorei(GLenum pname, GLint param) {
+	Call c(31);
+	glPixelStorei(pname, param);
+}
+void gl_trace_glReadBuffer(GLenum src) {
+	Call c(32);
+	glReadBuffer(src);
+}
+void gl_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	Call c(33);
+	glReadPixels(x, y, width, height, format, type, pixels);
+}
+void gl_trace_glGetBooleanv(GLenum pname, GLboolean *data) {
+	Call c(34);
+	glGetBooleanv(pname, data);
+}
+void gl_trace_glGetDoublev(GLenum pname, GLdouble *data) {
+	Call c(35);
+	glGetDoublev(pname, data);
+}
+GLenum gl_trace_glGetError(void) {
+	Call c(36);
+	return glGetError();
+}
+void gl_trace_glGetFloatv(GLenum pname, GLfloat *data) {
+	Call c(37);
+	glGetFloatv(pname, data);
+}
+void gl_trace_glGetIntegerv(GLenum pname, GLint *data) {
+	Call c(38);
+	glGetIntegerv(pname, data);
+}
+const GLubyte * gl_trace_glGetString(GLenum name) {
+	Call c(39);
+	return glGetString(name);
+}
+void gl_trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	Call c(40);
+	glGetTexImage(target, level, format, type, pixels);
+}
+void gl_trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	Call c(41);
+	glGetTexParameterfv(target, pname, params);
+}
+void gl_trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	Call c(42);
+	glGetTexParameteriv(target, pname, params);
+}
+void gl_trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	Call c(43);
+	glGetTexLevelParameterfv(target, level, pname, params);
+}
+void gl_trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	Call c(44);
+	glGetTexLevelParameteriv(target, level, pname, params);
+}
+GLboolean gl_trace_glIsEnabled(GLenum cap) {
+	Call c(45);
+	return glIsEnabled(cap);
+}
+void gl_trace_glDepthRange(GLdouble n, GLdouble f) {
+	Call c(46);
+	glDepthRange(n, f);
+}
+void gl_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	Call c(47);
+	glViewport(x, y, width, height);
+}
+void gl_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	Call c(48);
+	glDrawArrays(mode, first, count);
+}
+void gl_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	Call c(49);
+	glDrawElements(mode, count, type, indices);
+}
+void gl_trace_glGetPointerv(GLenum pname, void **params) {
+	Call c(50);
+	glGetPointerv(pname, params);
+}
+void gl_trace_glPolygonOffset(GLfloat factor, GLfloat units) {
+	Call c(51);
+	glPolygonOffset(factor, units);
+}
+void gl_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	Call c(52);
+	glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+void gl_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	Call c(53);
+	glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+void gl_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	Call c(54);
+	glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+void gl_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	Call c(55);
+	glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+void gl_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	Call c(56);
+	glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+void gl_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	Call c(57);
+	glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+void gl_trace_glBindTexture(GLenum target, GLuint texture) {
+	Call c(58);
+	glBindTexture(target, texture);
+}
+void gl_trace_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	Call c(59);
+	glDeleteTextures(n, textures);
+}
+void gl_trace_glGenTextures(GLsizei n, GLuint *textures) {
+	Call c(60);
+	glGenTextures(n, textures);
+}
+GLboolean gl_trace_glIsTexture(GLuint texture) {
+	Call c(61);
+	return glIsTexture(texture);
+}
+void gl_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	Call c(62);
+	glDrawRangeElements(mode, start, end, count, type, indices);
+}
+void gl_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	Call c(63);
+	glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+void gl_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	Call c(64);
+	glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+void gl_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	Call c(65);
+	glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+void gl_trace_glActiveTexture(GLenum texture) {
+	Call c(66);
+	glActiveTexture(texture);
+}
+void gl_trace_glSampleCoverage(GLfloat value, GLboolean invert) {
+	Call c(67);
+	glSampleCoverage(value, invert);
+}
+void gl_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	Call c(68);
+	glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+void gl_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	Call c(69);
+	glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+void gl_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	Call c(70);
+	glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+void gl_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	Call c(71);
+	glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+void gl_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	Call c(72);
+	glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+void gl_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	Call c(73);
+	glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+void gl_trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	Call c(74);
+	glGetCompressedTexImage(target, level, img);
+}
+void gl_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	Call c(75);
+	glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+void gl_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	Call c(76);
+	glMultiDrawArrays(mode, first, count, drawcount);
+}
+void gl_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	Call c(77);
+	glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+void gl_trace_glPointParameterf(GLenum pname, GLfloat param) {
+	Call c(78);
+	glPointParameterf(pname, param);
+}
+void gl_trace_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	Call c(79);
+	glPointParameterfv(pname, params);
+}
+void gl_trace_glPointParameteri(GLenum pname, GLint param) {
+	Call c(80);
+	glPointParameteri(pname, param);
+}
+void gl_trace_glPointParameteriv(GLenum pname, const GLint *params) {
+	Call c(81);
+	glPointParameteriv(pname, params);
+}
+void gl_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	Call c(82);
+	glBlendColor(red, green, blue, alpha);
+}
+void gl_trace_glBlendEquation(GLenum mode) {
+	Call c(83);
+	glBlendEquation(mode);
+}
+void gl_trace_glGenQueries(GLsizei n, GLuint *ids) {
+	Call c(84);
+	glGenQueries(n, ids);
+}
+void gl_trace_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	Call c(85);
+	glDeleteQueries(n, ids);
+}
+GLboolean gl_trace_glIsQuery(GLuint id) {
+	Call c(86);
+	return glIsQuery(id);
+}
+void gl_trace_glBeginQuery(GLenum target, GLuint id) {
+	Call c(87);
+	glBeginQuery(target, id);
+}
+void gl_trace_glEndQuery(GLenum target) {
+	Call c(88);
+	glEndQuery(target);
+}
+void gl_trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	Call c(89);
+	glGetQueryiv(target, pname, params);
+}
+void gl_trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	Call c(90);
+	glGetQueryObjectiv(id, pname, params);
+}
+void gl_trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	Call c(91);
+	glGetQueryObjectuiv(id, pname, params);
+}
+void gl_trace_glBindBuffer(GLenum target, GLuint buffer) {
+	Call c(92);
+	glBindBuffer(target, buffer);
+}
+void gl_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	Call c(93);
+	glDeleteBuffers(n, buffers);
+}
+void gl_trace_glGenBuffers(GLsizei n, GLuint *buffers) {
+	Call c(94);
+	glGenBuffers(n, buffers);
+}
+GLboolean gl_trace_glIsBuffer(GLuint buffer) {
+	Call c(95);
+	return glIsBuffer(buffer);
+}
+void gl_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	Call c(96);
+	glBufferData(target, size, data, usage);
+}
+void gl_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	Call c(97);
+	glBufferSubData(target, offset, size, data);
+}
+void gl_trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	Call c(98);
+	glGetBufferSubData(target, offset, size, data);
+}
+void * gl_trace_glMapBuffer(GLenum target, GLenum access) {
+	Call c(99);
+	return glMapBuffer(target, access);
+}
+GLboolean gl_trace_glUnmapBuffer(GLenum target) {
+	Call c(100);
+	return glUnmapBuffer(target);
+}
+void gl_trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	Call c(101);
+	glGetBufferParameteriv(target, pname, params);
+}
+void gl_trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	Call c(102);
+	glGetBufferPointerv(target, pname, params);
+}
+void gl_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	Call c(103);
+	glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+void gl_trace_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	Call c(104);
+	glDrawBuffers(n, bufs);
+}
+void gl_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	Call c(105);
+	glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+void gl_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	Call c(106);
+	glStencilFuncSeparate(face, func, ref, mask);
+}
+void gl_trace_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	Call c(107);
+	glStencilMaskSeparate(face, mask);
+}
+void gl_trace_glAttachShader(GLuint program, GLuint shader) {
+	Call c(108);
+	glAttachShader(program, shader);
+}
+void gl_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	Call c(109);
+	glBindAttribLocation(program, index, name);
+}
+void gl_trace_glCompileShader(GLuint shader) {
+	Call c(110);
+	glCompileShader(shader);
+}
+GLuint gl_trace_glCreateProgram(void) {
+	Call c(111);
+	return glCreateProgram();
+}
+GLuint gl_trace_glCreateShader(GLenum type) {
+	Call c(112);
+	return glCreateShader(type);
+}
+void gl_trace_glDeleteProgram(GLuint program) {
+	Call c(113);
+	glDeleteProgram(program);
+}
+void gl_trace_glDeleteShader(GLuint shader) {
+	Call c(114);
+	glDeleteShader(shader);
+}
+void gl_trace_glDetachShader(GLuint program, GLuint shader) {
+	Call c(115);
+	glDetachShader(program, shader);
+}
+void gl_trace_glDisableVertexAttribArray(GLuint index) {
+	Call c(116);
+	glDisableVertexAttribArray(index);
+}
+void gl_trace_glEnableVertexAttribArray(GLuint index) {
+	Call c(117);
+	glEnableVertexAttribArray(index);
+}
+void gl_trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	Call c(118);
+	glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+void gl_trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	Call c(119);
+	glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+void gl_trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	Call c(120);
+	glGetAttachedShaders(program, maxCount, count, shaders);
+}
+GLint gl_trace_glGetAttribLocation(GLuint program, const GLchar *name) {
+	Call c(121);
+	return glGetAttribLocation(program, name);
+}
+void gl_trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	Call c(122);
+	glGetProgramiv(program, pname, params);
+}
+void gl_trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	Call c(123);
+	glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+void gl_trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	Call c(124);
+	glGetShaderiv(shader, pname, params);
+}
+void gl_trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	Call c(125);
+	glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+void gl_trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	Call c(126);
+	glGetShaderSource(shader, bufSize, length, source);
+}
+GLint gl_trace_glGetUniformLocation(GLuint program, const GLchar *name) {
+	Call c(127);
+	return glGetUniformLocation(program, name);
+}
+void gl_trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	Call c(128);
+	glGetUniformfv(program, location, params);
+}
+void gl_trace_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	Call c(129);
+	glGetUniformiv(program, location, params);
+}
+void gl_trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	Call c(130);
+	glGetVertexAttribdv(index, pname, params);
+}
+void gl_trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	Call c(131);
+	glGetVertexAttribfv(index, pname, params);
+}
+void gl_trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	Call c(132);
+	glGetVertexAttribiv(index, pname, params);
+}
+void gl_trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	Call c(133);
+	glGetVertexAttribPointerv(index, pname, pointer);
+}
+GLboolean gl_trace_glIsProgram(GLuint program) {
+	Call c(134);
+	return glIsProgram(program);
+}
+GLboolean gl_trace_glIsShader(GLuint shader) {
+	Call c(135);
+	return glIsShader(shader);
+}
+void gl_trace_glLinkProgram(GLuint program) {
+	Call c(136);
+	glLinkProgram(program);
+}
+void gl_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	Call c(137);
+	glShaderSource(shader, count, string, length);
+}
+void gl_trace_glUseProgram(GLuint program) {
+	Call c(138);
+	glUseProgram(program);
+}
+void gl_trace_glUniform1f(GLint location, GLfloat v0) {
+	Call c(139);
+	glUniform1f(location, v0);
+}
+void gl_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	Call c(140);
+	glUniform2f(location, v0, v1);
+}
+void gl_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	Call c(141);
+	glUniform3f(location, v0, v1, v2);
+}
+void gl_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	Call c(142);
+	glUniform4f(location, v0, v1, v2, v3);
+}
+void gl_trace_glUniform1i(GLint location, GLint v0) {
+	Call c(143);
+	glUniform1i(location, v0);
+}
+void gl_trace_glUniform2i(GLint location, GLint v0, GLint v1) {
+	Call c(144);
+	glUniform2i(location, v0, v1);
+}
+void gl_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	Call c(145);
+	glUniform3i(location, v0, v1, v2);
+}
+void gl_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	Call c(146);
+	glUniform4i(location, v0, v1, v2, v3);
+}
+void gl_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	Call c(147);
+	glUniform1fv(location, count, value);
+}
+void gl_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	Call c(148);
+	glUniform2fv(location, count, value);
+}
+void gl_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	Call c(149);
+	glUniform3fv(location, count, value);
+}
+void gl_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	Call c(150);
+	glUniform4fv(location, count, value);
+}
+void gl_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	Call c(151);
+	glUniform1iv(location, count, value);
+}
+void gl_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	Call c(152);
+	glUniform2iv(location, count, value);
+}
+void gl_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	Call c(153);
+	glUniform3iv(location, count, value);
+}
+void gl_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	Call c(154);
+	glUniform4iv(location, count, value);
+}
+void gl_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(155);
+	glUniformMatrix2fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(156);
+	glUniformMatrix3fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(157);
+	glUniformMatrix4fv(location, count, transpose, value);
+}
+void gl_trace_glValidateProgram(GLuint program) {
+	Call c(158);
+	glValidateProgram(program);
+}
+void gl_trace_glVertexAttrib1d(GLuint index, GLdouble x) {
+	Call c(159);
+	glVertexAttrib1d(index, x);
+}
+void gl_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	Call c(160);
+	glVertexAttrib1dv(index, v);
+}
+void gl_trace_glVertexAttrib1f(GLuint index, GLfloat x) {
+	Call c(161);
+	glVertexAttrib1f(index, x);
+}
+void gl_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	Call c(162);
+	glVertexAttrib1fv(index, v);
+}
+void gl_trace_glVertexAttrib1s(GLuint index, GLshort x) {
+	Call c(163);
+	glVertexAttrib1s(index, x);
+}
+void gl_trace_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	Call c(164);
+	glVertexAttrib1sv(index, v);
+}
+void gl_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	Call c(165);
+	glVertexAttrib2d(index, x, y);
+}
+void gl_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	Call c(166);
+	glVertexAttrib2dv(index, v);
+}
+void gl_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	Call c(167);
+	glVertexAttrib2f(index, x, y);
+}
+void gl_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	Call c(168);
+	glVertexAttrib2fv(index, v);
+}
+void gl_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	Call c(169);
+	glVertexAttrib2s(index, x, y);
+}
+void gl_trace_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	Call c(170);
+	glVertexAttrib2sv(index, v);
+}
+void gl_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	Call c(171);
+	glVertexAttrib3d(index, x, y, z);
+}
+void gl_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	Call c(172);
+	glVertexAttrib3dv(index, v);
+}
+void gl_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	Call c(173);
+	glVertexAttrib3f(index, x, y, z);
+}
+void gl_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	Call c(174);
+	glVertexAttrib3fv(index, v);
+}
+void gl_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	Call c(175);
+	glVertexAttrib3s(index, x, y, z);
+}
+void gl_trace_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	Call c(176);
+	glVertexAttrib3sv(index, v);
+}
+void gl_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	Call c(177);
+	glVertexAttrib4Nbv(index, v);
+}
+void gl_trace_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	Call c(178);
+	glVertexAttrib4Niv(index, v);
+}
+void gl_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	Call c(179);
+	glVertexAttrib4Nsv(index, v);
+}
+void gl_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	Call c(180);
+	glVertexAttrib4Nub(index, x, y, z, w);
+}
+void gl_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	Call c(181);
+	glVertexAttrib4Nubv(index, v);
+}
+void gl_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	Call c(182);
+	glVertexAttrib4Nuiv(index, v);
+}
+void gl_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	Call c(183);
+	glVertexAttrib4Nusv(index, v);
+}
+void gl_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	Call c(184);
+	glVertexAttrib4bv(index, v);
+}
+void gl_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	Call c(185);
+	glVertexAttrib4d(index, x, y, z, w);
+}
+void gl_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	Call c(186);
+	glVertexAttrib4dv(index, v);
+}
+void gl_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	Call c(187);
+	glVertexAttrib4f(index, x, y, z, w);
+}
+void gl_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	Call c(188);
+	glVertexAttrib4fv(index, v);
+}
+void gl_trace_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	Call c(189);
+	glVertexAttrib4iv(index, v);
+}
+void gl_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	Call c(190);
+	glVertexAttrib4s(index, x, y, z, w);
+}
+void gl_trace_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	Call c(191);
+	glVertexAttrib4sv(index, v);
+}
+void gl_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	Call c(192);
+	glVertexAttrib4ubv(index, v);
+}
+void gl_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	Call c(193);
+	glVertexAttrib4uiv(index, v);
+}
+void gl_trace_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	Call c(194);
+	glVertexAttrib4usv(index, v);
+}
+void gl_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	Call c(195);
+	glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+void gl_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(196);
+	glUniformMatrix2x3fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(197);
+	glUniformMatrix3x2fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(198);
+	glUniformMatrix2x4fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(199);
+	glUniformMatrix4x2fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(200);
+	glUniformMatrix3x4fv(location, count, transpose, value);
+}
+void gl_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	Call c(201);
+	glUniformMatrix4x3fv(location, count, transpose, value);
+}
+void gl_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	Call c(202);
+	glColorMaski(index, r, g, b, a);
+}
+void gl_trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	Call c(203);
+	glGetBooleani_v(target, index, data);
+}
+void gl_trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	Call c(204);
+	glGetIntegeri_v(target, index, data);
+}
+void gl_trace_glEnablei(GLenum target, GLuint index) {
+	Call c(205);
+	glEnablei(target, index);
+}
+void gl_trace_glDisablei(GLenum target, GLuint index) {
+	Call c(206);
+	glDisablei(target, index);
+}
+GLboolean gl_trace_glIsEnabledi(GLenum target, GLuint index) {
+	Call c(207);
+	return glIsEnabledi(target, index);
+}
+void gl_trace_glBeginTransformFeedback(GLenum primitiveMode) {
+	Call c(208);
+	glBeginTransformFeedback(primitiveMode);
+}
+void gl_trace_glEndTransformFeedback(void) {
+	Call c(209);
+	glEndTransformFeedback();
+}
+void gl_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	Call c(210);
+	glBindBufferRange(target, index, buffer, offset, size);
+}
+void gl_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	Call c(211);
+	glBindBufferBase(target, index, buffer);
+}
+void gl_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	Call c(212);
+	glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+void gl_trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	Call c(213);
+	glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+void gl_trace_glClampColor(GLenum target, GLenum clamp) {
+	Call c(214);
+	glClampColor(target, clamp);
+}
+void gl_trace_glBeginConditionalRender(GLuint id, GLenum mode) {
+	Call c(215);
+	glBeginConditionalRender(id, mode);
+}
+void gl_trace_glEndConditionalRender(void) {
+	Call c(216);
+	glEndConditionalRender();
+}
+void gl_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	Call c(217);
+	glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+void gl_trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	Call c(218);
+	glGetVertexAttribIiv(index, pname, params);
+}
+void gl_trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	Call c(219);
+	glGetVertexAttribIuiv(index, pname, params);
+}
+void gl_trace_glVertexAttribI1i(GLuint index, GLint x) {
+	Call c(220);
+	glVertexAttribI1i(index, x);
+}
+void gl_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	Call c(221);
+	glVertexAttribI2i(index, x, y);
+}
+void gl_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	Call c(222);
+	glVertexAttribI3i(index, x, y, z);
+}
+void gl_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	Call c(223);
+	glVertexAttribI4i(index, x, y, z, w);
+}
+void gl_trace_glVertexAttribI1ui(GLuint index, GLuint x) {
+	Call c(224);
+	glVertexAttribI1ui(index, x);
+}
+void gl_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	Call c(225);
+	glVertexAttribI2ui(index, x, y);
+}
+void gl_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	Call c(226);
+	glVertexAttribI3ui(index, x, y, z);
+}
+void gl_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	Call c(227);
+	glVertexAttribI4ui(index, x, y, z, w);
+}
+void gl_trace_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	Call c(228);
+	glVertexAttribI1iv(index, v);
+}
+void gl_trace_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	Call c(229);
+	glVertexAttribI2iv(index, v);
+}
+void gl_trace_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	Call c(230);
+	glVertexAttribI3iv(index, v);
+}
+void gl_trace_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	Call c(231);
+	glVertexAttribI4iv(index, v);
+}
+void gl_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	Call c(232);
+	glVertexAttribI1uiv(index, v);
+}
+void gl_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	Call c(233);
+	glVertexAttribI2uiv(index, v);
+}
+void gl_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	Call c(234);
+	glVertexAttribI3uiv(index, v);
+}
+void gl_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	Call c(235);
+	glVertexAttribI4uiv(index, v);
+}
+void gl_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	Call c(236);
+	glVertexAttribI4bv(index, v);
+}
+void gl_trace_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	Call c(237);
+	glVertexAttribI4sv(index, v);
+}
+void gl_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	Call c(238);
+	glVertexAttribI4ubv(index, v);
+}
+void gl_trace_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	Call c(239);
+	glVertexAttribI4usv(index, v);
+}
+void gl_trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	Call c(240);
+	glGetUniformuiv(program, location, params);
+}
+void gl_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	Call c(241);
+	glBindFragDataLocation(program, color, name);
+}
+GLint gl_trace_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	Call c(242);
+	return glGetFragDataLocation(program, name);
+}
+void gl_trace_glUniform1ui(GLint location, GLuint v0) {
+	Call c(243);
+	glUniform1ui(location, v0);
+}
+void gl_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	Call c(244);
+	glUniform2ui(location, v0, v1);
+}
+void gl_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	Call c(245);
+	glUniform3ui(location, v0, v1, v2);
+}
+void gl_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	Call c(246);
+	glUniform4ui(location, v0, v1, v2, v3);
+}
+void gl_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	Call c(247);
+	glUniform1uiv(location, count, value);
+}
+void gl_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	Call c(248);
+	glUniform2uiv(location, count, value);
+}
+void gl_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	Call c(249);
+	glUniform3uiv(location, count, value);
+}
+void gl_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	Call c(250);
+	glUniform4uiv(location, count, value);
+}
+void gl_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	Call c(251);
+	glTexParameterIiv(target, pname, params);
+}
+void gl_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	Call c(252);
+	glTexParameterIuiv(target, pname, params);
+}
+void gl_trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	Call c(253);
+	glGetTexParameterIiv(target, pname, params);
+}
+void gl_trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	Call c(254);
+	glGetTexParameterIuiv(target, pname, params);
+}
+void gl_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	Call c(255);
+	glClearBufferiv(buffer, drawbuffer, value);
+}
+void gl_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	Call c(256);
+	glClearBufferuiv(buffer, drawbuffer, value);
+}
+void gl_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	Call c(257);
+	glClearBufferfv(buffer, drawbuffer, value);
+}
+void gl_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	Call c(258);
+	glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+const GLubyte * gl_trace_glGetStringi(GLenum name, GLuint index) {
+	Call c(259);
+	return glGetStringi(name, index);
+}
+GLboolean gl_trace_glIsRenderbuffer(GLuint renderbuffer) {
+	Call c(260);
+	return glIsRenderbuffer(renderbuffer);
+}
+void gl_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	Call c(261);
+	glBindRenderbuffer(target, renderbuffer);
+}
+void gl_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	Call c(262);
+	glDeleteRenderbuffers(n, renderbuffers);
+}
+void gl_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	Call c(263);
+	glGenRenderbuffers(n, renderbuffers);
+}
+void gl_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	Call c(264);
+	glRenderbufferStorage(target, internalformat, width, height);
+}
+void gl_trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	Call c(265);
+	glGetRenderbufferParameteriv(target, pname, params);
+}
+GLboolean gl_trace_glIsFramebuffer(GLuint framebuffer) {
+	Call c(266);
+	return glIsFramebuffer(framebuffer);
+}
+void gl_trace_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	Call c(267);
+	glBindFramebuffer(target, framebuffer);
+}
+void gl_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	Call c(268);
+	glDeleteFramebuffers(n, framebuffers);
+}
+void gl_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	Call c(269);
+	glGenFramebuffers(n, framebuffers);
+}
+GLenum gl_trace_glCheckFramebufferStatus(GLenum target) {
+	Call c(270);
+	return glCheckFramebufferStatus(target);
+}
+void gl_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	Call c(271);
+	glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+void gl_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	Call c(272);
+	glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+void gl_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	Call c(273);
+	glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+void gl_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	Call c(274);
+	glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+void gl_trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	Call c(275);
+	glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+void gl_trace_glGenerateMipmap(GLenum target) {
+	Call c(276);
+	glGenerateMipmap(target);
+}
+void gl_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	Call c(277);
+	glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+void gl_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	Call c(278);
+	glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+void gl_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	Call c(279);
+	glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+void * gl_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	Call c(280);
+	return glMapBufferRange(target, offset, length, access);
+}
+void gl_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	Call c(281);
+	glFlushMappedBufferRange(target, offset, length);
+}
+void gl_trace_glBindVertexArray(GLuint array) {
+	Call c(282);
+	glBindVertexArray(array);
+}
+void gl_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	Call c(283);
+	glDeleteVertexArrays(n, arrays);
+}
+void gl_trace_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	Call c(284);
+	glGenVertexArrays(n, arrays);
+}
+GLboolean gl_trace_glIsVertexArray(GLuint array) {
+	Call c(285);
+	return glIsVertexArray(array);
+}
+void gl_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	Call c(286);
+	glDrawArraysInstanced(mode, first, count, instancecount);
+}
+void gl_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	Call c(287);
+	glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+void gl_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	Call c(288);
+	glTexBuffer(target, internalformat, buffer);
+}
+void gl_trace_glPrimitiveRestartIndex(GLuint index) {
+	Call c(289);
+	glPrimitiveRestartIndex(index);
+}
+void gl_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	Call c(290);
+	glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+void gl_trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	Call c(291);
+	glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+void gl_trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	Call c(292);
+	glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+void gl_trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	Call c(293);
+	glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+GLuint gl_trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	Call c(294);
+	return glGetUniformBlockIndex(program, uniformBlockName);
+}
+void gl_trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	Call c(295);
+	glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+void gl_trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	Call c(296);
+	glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+void gl_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	Call c(297);
+	glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+void gl_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	Call c(298);
+	glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+void gl_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	Call c(299);
+	glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+void gl_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	Call c(300);
+	glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+void gl_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	Call c(301);
+	glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+void gl_trace_glProvokingVertex(GLenum mode) {
+	Call c(302);
+	glProvokingVertex(mode);
+}
+GLsync gl_trace_glFenceSync(GLenum condition, GLbitfield flags) {
+	Call c(303);
+	return glFenceSync(condition, flags);
+}
+GLboolean gl_trace_glIsSync(GLsync sync) {
+	Call c(304);
+	return glIsSync(sync);
+}
+void gl_trace_glDeleteSync(GLsync sync) {
+	Call c(305);
+	glDeleteSync(sync);
+}
+GLenum gl_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	Call c(306);
+	return glClientWaitSync(sync, flags, timeout);
+}
+void gl_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	Call c(307);
+	glWaitSync(sync, flags, timeout);
+}
+void gl_trace_glGetInteger64v(GLenum pname, GLint64 *data) {
+	Call c(308);
+	glGetInteger64v(pname, data);
+}
+void gl_trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+	Call c(309);
+	glGetSynciv(sync, pname, bufSize, length, values);
+}
+void gl_trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	Call c(310);
+	glGetInteger64i_v(target, index, data);
+}
+void gl_trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	Call c(311);
+	glGetBufferParameteri64v(target, pname, params);
+}
+void gl_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	Call c(312);
+	glFramebufferTexture(target, attachment, texture, level);
+}
+void gl_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	Call c(313);
+	glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+void gl_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	Call c(314);
+	glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+void gl_trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	Call c(315);
+	glGetMultisamplefv(pname, index, val);
+}
+void gl_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	Call c(316);
+	glSampleMaski(maskNumber, mask);
+}
+void gl_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	Call c(317);
+	glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+GLint gl_trace_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	Call c(318);
+	return glGetFragDataIndex(program, name);
+}
+void gl_trace_glGenSamplers(GLsizei count, GLuint *samplers) {
+	Call c(319);
+	glGenSamplers(count, samplers);
+}
+void gl_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	Call c(320);
+	glDeleteSamplers(count, samplers);
+}
+GLboolean gl_trace_glIsSampler(GLuint sampler) {
+	Call c(321);
+	return glIsSampler(sampler);
+}
+void gl_trace_glBindSampler(GLuint unit, GLuint sampler) {
+	Call c(322);
+	glBindSampler(unit, sampler);
+}
+void gl_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	Call c(323);
+	glSamplerParameteri(sampler, pname, param);
+}
+void gl_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	Call c(324);
+	glSamplerParameteriv(sampler, pname, param);
+}
+void gl_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	Call c(325);
+	glSamplerParameterf(sampler, pname, param);
+}
+void gl_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	Call c(326);
+	glSamplerParameterfv(sampler, pname, param);
+}
+void gl_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	Call c(327);
+	glSamplerParameterIiv(sampler, pname, param);
+}
+void gl_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	Call c(328);
+	glSamplerParameterIuiv(sampler, pname, param);
+}
+void gl_trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	Call c(329);
+	glGetSamplerParameteriv(sampler, pname, params);
+}
+void gl_trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	Call c(330);
+	glGetSamplerParameterIiv(sampler, pname, params);
+}
+void gl_trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	Call c(331);
+	glGetSamplerParameterfv(sampler, pname, params);
+}
+void gl_trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	Call c(332);
+	glGetSamplerParameterIuiv(sampler, pname, params);
+}
+void gl_trace_glQueryCounter(GLuint id, GLenum target) {
+	Call c(333);
+	glQueryCounter(id, target);
+}
+void gl_trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	Call c(334);
+	glGetQueryObjecti64v(id, pname, params);
+}
+void gl_trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	Call c(335);
+	glGetQueryObjectui64v(id, pname, params);
+}
+void gl_trace_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	Call c(336);
+	glVertexAttribDivisor(index, divisor);
+}
+void gl_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Call c(337);
+	glVertexAttribP1ui(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Call c(338);
+	glVertexAttribP1uiv(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Call c(339);
+	glVertexAttribP2ui(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Call c(340);
+	glVertexAttribP2uiv(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Call c(341);
+	glVertexAttribP3ui(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Call c(342);
+	glVertexAttribP3uiv(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	Call c(343);
+	glVertexAttribP4ui(index, type, normalized, value);
+}
+void gl_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	Call c(344);
+	glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+#endif //GL_TRACE
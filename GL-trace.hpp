@@ -0,0 +1,738 @@
+#pragma once
+
+/*
+ * Counting (and optionally timing) layer over every OpenGL entry point in GL.hpp.
+ *
+ * Only used when building with GL_TRACE defined (GL.hpp includes this file);
+ *  otherwise gl* calls go straight to OpenGL and this costs nothing.
+ *
+ * With GL_TRACE, every gl* call is replaced (by a macro) with a call to a
+ *  gl_trace_gl* wrapper that counts it (and, if GLTrace::timing is set,
+ *  measures how long the call took on the CPU).
+ *
+ * Call GLTrace::end_frame() once per frame; GLTrace::hottest() then lists
+ *  the previous frame's most-called functions.
+ *
+ * This file has been automatically generated by make-GL.py
+ *
+ */
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace GLTrace {
+	//also measure time spent in each call? (adds two clock reads per call)
+	extern bool timing;
+
+	//per-function numbers for one frame:
+	struct Stat {
+		char const *name;
+		uint64_t calls;
+		uint64_t ns; //only if timing
+	};
+
+	//finish counting a frame:
+	void end_frame();
+
+	//up to 'count' functions from the last finished frame, most calls first:
+	std::vector< Stat > hottest(uint32_t count);
+
+	//write the last finished frame's counts for every called function, most calls first:
+	void report(std::ostream &out);
+}
+
+void gl_trace_glCullFace(GLenum mode);
+void gl_trace_glFrontFace(GLenum mode);
+void gl_trace_glHint(GLenum target, GLenum mode);
+void gl_trace_glLineWidth(GLfloat width);
+void gl_trace_glPointSize(GLfloat size);
+void gl_trace_glPolygonMode(GLenum face, GLenum mode);
+void gl_trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param);
+void gl_trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params);
+void gl_trace_glTexParameteri(GLenum target, GLenum pname, GLint param);
+void gl_trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params);
+void gl_trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
+void gl_trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+void gl_trace_glDrawBuffer(GLenum buf);
+void gl_trace_glClear(GLbitfield mask);
+void gl_trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void gl_trace_glClearStencil(GLint s);
+void gl_trace_glClearDepth(GLdouble depth);
+void gl_trace_glStencilMask(GLuint mask);
+void gl_trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+void gl_trace_glDepthMask(GLboolean flag);
+void gl_trace_glDisable(GLenum cap);
+void gl_trace_glEnable(GLenum cap);
+void gl_trace_glFinish(void);
+void gl_trace_glFlush(void);
+void gl_trace_glBlendFunc(GLenum sfactor, GLenum dfactor);
+void gl_trace_glLogicOp(GLenum opcode);
+void gl_trace_glStencilFunc(GLenum func, GLint ref, GLuint mask);
+void gl_trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass);
+void gl_trace_glDepthFunc(GLenum func);
+void gl_trace_glPixelStoref(GLenum pname, GLfloat param);
+void gl_trace_glPixelStorei(GLenum pname, GLint param);
+void gl_trace_glReadBuffer(GLenum src);
+void gl_trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+void gl_trace_glGetBooleanv(GLenum pname, GLboolean *data);
+void gl_trace_glGetDoublev(GLenum pname, GLdouble *data);
+GLenum gl_trace_glGetError(void);
+void gl_trace_glGetFloatv(GLenum pname, GLfloat *data);
+void gl_trace_glGetIntegerv(GLenum pname, GLint *data);
+const GLubyte * gl_trace_glGetString(GLenum name);
+void gl_trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
+void gl_trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params);
+void gl_trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params);
+void gl_trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params);
+void gl_trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params);
+GLboolean gl_trace_glIsEnabled(GLenum cap);
+void gl_trace_glDepthRange(GLdouble n, GLdouble f);
+void gl_trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_trace_glDrawArrays(GLenum mode, GLint first, GLsizei count);
+void gl_trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
+void gl_trace_glGetPointerv(GLenum pname, void **params);
+void gl_trace_glPolygonOffset(GLfloat factor, GLfloat units);
+void gl_trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
+void gl_trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
+void gl_trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+void gl_trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+void gl_trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+void gl_trace_glBindTexture(GLenum target, GLuint texture);
+void gl_trace_glDeleteTextures(GLsizei n, const GLuint *textures);
+void gl_trace_glGenTextures(GLsizei n, GLuint *textures);
+GLboolean gl_trace_glIsTexture(GLuint texture);
+void gl_trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
+void gl_trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
+void gl_trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+void gl_trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+void gl_trace_glActiveTexture(GLenum texture);
+void gl_trace_glSampleCoverage(GLfloat value, GLboolean invert);
+void gl_trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data);
+void gl_trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
+void gl_trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data);
+void gl_trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
+void gl_trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
+void gl_trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
+void gl_trace_glGetCompressedTexImage(GLenum target, GLint level, void *img);
+void gl_trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+void gl_trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
+void gl_trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
+void gl_trace_glPointParameterf(GLenum pname, GLfloat param);
+void gl_trace_glPointParameterfv(GLenum pname, const GLfloat *params);
+void gl_trace_glPointParameteri(GLenum pname, GLint param);
+void gl_trace_glPointParameteriv(GLenum pname, const GLint *params);
+void gl_trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void gl_trace_glBlendEquation(GLenum mode);
+void gl_trace_glGenQueries(GLsizei n, GLuint *ids);
+void gl_trace_glDeleteQueries(GLsizei n, const GLuint *ids);
+GLboolean gl_trace_glIsQuery(GLuint id);
+void gl_trace_glBeginQuery(GLenum target, GLuint id);
+void gl_trace_glEndQuery(GLenum target);
+void gl_trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params);
+void gl_trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params);
+void gl_trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params);
+void gl_trace_glBindBuffer(GLenum target, GLuint buffer);
+void gl_trace_glDeleteBuffers(GLsizei n, const GLuint *buffers);
+void gl_trace_glGenBuffers(GLsizei n, GLuint *buffers);
+GLboolean gl_trace_glIsBuffer(GLuint buffer);
+void gl_trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+void gl_trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+void gl_trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data);
+void * gl_trace_glMapBuffer(GLenum target, GLenum access);
+GLboolean gl_trace_glUnmapBuffer(GLenum target);
+void gl_trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params);
+void gl_trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params);
+void gl_trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha);
+void gl_trace_glDrawBuffers(GLsizei n, const GLenum *bufs);
+void gl_trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
+void gl_trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask);
+void gl_trace_glStencilMaskSeparate(GLenum face, GLuint mask);
+void gl_trace_glAttachShader(GLuint program, GLuint shader);
+void gl_trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name);
+void gl_trace_glCompileShader(GLuint shader);
+GLuint gl_trace_glCreateProgram(void);
+GLuint gl_trace_glCreateShader(GLenum type);
+void gl_trace_glDeleteProgram(GLuint program);
+void gl_trace_glDeleteShader(GLuint shader);
+void gl_trace_glDetachShader(GLuint program, GLuint shader);
+void gl_trace_glDisableVertexAttribArray(GLuint index);
+void gl_trace_glEnableVertexAttribArray(GLuint index);
+void gl_trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void gl_trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+void gl_trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
+GLint gl_trace_glGetAttribLocation(GLuint program, const GLchar *name);
+void gl_trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params);
+void gl_trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void gl_trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params);
+void gl_trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void gl_trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);
+GLint gl_trace_glGetUniformLocation(GLuint program, const GLchar *name);
+void gl_trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params);
+void gl_trace_glGetUniformiv(GLuint program, GLint location, GLint *params);
+void gl_trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params);
+void gl_trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params);
+void gl_trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params);
+void gl_trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer);
+GLboolean gl_trace_glIsProgram(GLuint program);
+GLboolean gl_trace_glIsShader(GLuint shader);
+void gl_trace_glLinkProgram(GLuint program);
+void gl_trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
+void gl_trace_glUseProgram(GLuint program);
+void gl_trace_glUniform1f(GLint location, GLfloat v0);
+void gl_trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1);
+void gl_trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+void gl_trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+void gl_trace_glUniform1i(GLint location, GLint v0);
+void gl_trace_glUniform2i(GLint location, GLint v0, GLint v1);
+void gl_trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2);
+void gl_trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+void gl_trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value);
+void gl_trace_glUniform1iv(GLint location, GLsizei count, const GLint *value);
+void gl_trace_glUniform2iv(GLint location, GLsizei count, const GLint *value);
+void gl_trace_glUniform3iv(GLint location, GLsizei count, const GLint *value);
+void gl_trace_glUniform4iv(GLint location, GLsizei count, const GLint *value);
+void gl_trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glValidateProgram(GLuint program);
+void gl_trace_glVertexAttrib1d(GLuint index, GLdouble x);
+void gl_trace_glVertexAttrib1dv(GLuint index, const GLdouble *v);
+void gl_trace_glVertexAttrib1f(GLuint index, GLfloat x);
+void gl_trace_glVertexAttrib1fv(GLuint index, const GLfloat *v);
+void gl_trace_glVertexAttrib1s(GLuint index, GLshort x);
+void gl_trace_glVertexAttrib1sv(GLuint index, const GLshort *v);
+void gl_trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y);
+void gl_trace_glVertexAttrib2dv(GLuint index, const GLdouble *v);
+void gl_trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y);
+void gl_trace_glVertexAttrib2fv(GLuint index, const GLfloat *v);
+void gl_trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y);
+void gl_trace_glVertexAttrib2sv(GLuint index, const GLshort *v);
+void gl_trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z);
+void gl_trace_glVertexAttrib3dv(GLuint index, const GLdouble *v);
+void gl_trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z);
+void gl_trace_glVertexAttrib3fv(GLuint index, const GLfloat *v);
+void gl_trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z);
+void gl_trace_glVertexAttrib3sv(GLuint index, const GLshort *v);
+void gl_trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v);
+void gl_trace_glVertexAttrib4Niv(GLuint index, const GLint *v);
+void gl_trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v);
+void gl_trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
+void gl_trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v);
+void gl_trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v);
+void gl_trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v);
+void gl_trace_glVertexAttrib4bv(GLuint index, const GLbyte *v);
+void gl_trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+void gl_trace_glVertexAttrib4dv(GLuint index, const GLdouble *v);
+void gl_trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+void gl_trace_glVertexAttrib4fv(GLuint index, const GLfloat *v);
+void gl_trace_glVertexAttrib4iv(GLuint index, const GLint *v);
+void gl_trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
+void gl_trace_glVertexAttrib4sv(GLuint index, const GLshort *v);
+void gl_trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v);
+void gl_trace_glVertexAttrib4uiv(GLuint index, const GLuint *v);
+void gl_trace_glVertexAttrib4usv(GLuint index, const GLushort *v);
+void gl_trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+void gl_trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void gl_trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+void gl_trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data);
+void gl_trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data);
+void gl_trace_glEnablei(GLenum target, GLuint index);
+void gl_trace_glDisablei(GLenum target, GLuint index);
+GLboolean gl_trace_glIsEnabledi(GLenum target, GLuint index);
+void gl_trace_glBeginTransformFeedback(GLenum primitiveMode);
+void gl_trace_glEndTransformFeedback(void);
+void gl_trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+void gl_trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer);
+void gl_trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
+void gl_trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name);
+void gl_trace_glClampColor(GLenum target, GLenum clamp);
+void gl_trace_glBeginConditionalRender(GLuint id, GLenum mode);
+void gl_trace_glEndConditionalRender(void);
+void gl_trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+void gl_trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params);
+void gl_trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params);
+void gl_trace_glVertexAttribI1i(GLuint index, GLint x);
+void gl_trace_glVertexAttribI2i(GLuint index, GLint x, GLint y);
+void gl_trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z);
+void gl_trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w);
+void gl_trace_glVertexAttribI1ui(GLuint index, GLuint x);
+void gl_trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y);
+void gl_trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z);
+void gl_trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
+void gl_trace_glVertexAttribI1iv(GLuint index, const GLint *v);
+void gl_trace_glVertexAttribI2iv(GLuint index, const GLint *v);
+void gl_trace_glVertexAttribI3iv(GLuint index, const GLint *v);
+void gl_trace_glVertexAttribI4iv(GLuint index, const GLint *v);
+void gl_trace_glVertexAttribI1uiv(GLuint index, const GLuint *v);
+void gl_trace_glVertexAttribI2uiv(GLuint index, const GLuint *v);
+void gl_trace_glVertexAttribI3uiv(GLuint index, const GLuint *v);
+void gl_trace_glVertexAttribI4uiv(GLuint index, const GLuint *v);
+void gl_trace_glVertexAttribI4bv(GLuint index, const GLbyte *v);
+void gl_trace_glVertexAttribI4sv(GLuint index, const GLshort *v);
+void gl_trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v);
+void gl_trace_glVertexAttribI4usv(GLuint index, const GLushort *v);
+void gl_trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params);
+void gl_trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name);
+GLint gl_trace_glGetFragDataLocation(GLuint program, const GLchar *name);
+void gl_trace_glUniform1ui(GLint location, GLuint v0);
+void gl_trace_glUniform2ui(GLint location, GLuint v0, GLuint v1);
+void gl_trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2);
+void gl_trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
+void gl_trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value);
+void gl_trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params);
+void gl_trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params);
+void gl_trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params);
+void gl_trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params);
+void gl_trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value);
+void gl_trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value);
+void gl_trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value);
+void gl_trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
+const GLubyte * gl_trace_glGetStringi(GLenum name, GLuint index);
+GLboolean gl_trace_glIsRenderbuffer(GLuint renderbuffer);
+void gl_trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer);
+void gl_trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers);
+void gl_trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers);
+void gl_trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+void gl_trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params);
+GLboolean gl_trace_glIsFramebuffer(GLuint framebuffer);
+void gl_trace_glBindFramebuffer(GLenum target, GLuint framebuffer);
+void gl_trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers);
+void gl_trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers);
+GLenum gl_trace_glCheckFramebufferStatus(GLenum target);
+void gl_trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void gl_trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+void gl_trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset);
+void gl_trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+void gl_trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params);
+void gl_trace_glGenerateMipmap(GLenum target);
+void gl_trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+void gl_trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
+void gl_trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
+void * gl_trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+void gl_trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length);
+void gl_trace_glBindVertexArray(GLuint array);
+void gl_trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays);
+void gl_trace_glGenVertexArrays(GLsizei n, GLuint *arrays);
+GLboolean gl_trace_glIsVertexArray(GLuint array);
+void gl_trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+void gl_trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+void gl_trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer);
+void gl_trace_glPrimitiveRestartIndex(GLuint index);
+void gl_trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+void gl_trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices);
+void gl_trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
+void gl_trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);
+GLuint gl_trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName);
+void gl_trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
+void gl_trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
+void gl_trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+void gl_trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+void gl_trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+void gl_trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
+void gl_trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
+void gl_trace_glProvokingVertex(GLenum mode);
+GLsync gl_trace_glFenceSync(GLenum condition, GLbitfield flags);
+GLboolean gl_trace_glIsSync(GLsync sync);
+void gl_trace_glDeleteSync(GLsync sync);
+GLenum gl_trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+void gl_trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+void gl_trace_glGetInteger64v(GLenum pname, GLint64 *data);
+void gl_trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
+void gl_trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data);
+void gl_trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params);
+void gl_trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level);
+void gl_trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+void gl_trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+void gl_trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val);
+void gl_trace_glSampleMaski(GLuint maskNumber, GLbitfield mask);
+void gl_trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name);
+GLint gl_trace_glGetFragDataIndex(GLuint program, const GLchar *name);
+void gl_trace_glGenSamplers(GLsizei count, GLuint *samplers);
+void gl_trace_glDeleteSamplers(GLsizei count, const GLuint *samplers);
+GLboolean gl_trace_glIsSampler(GLuint sampler);
+void gl_trace_glBindSampler(GLuint unit, GLuint sampler);
+void gl_trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param);
+void gl_trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param);
+void gl_trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param);
+void gl_trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param);
+void gl_trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param);
+void gl_trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param);
+void gl_trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params);
+void gl_trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params);
+void gl_trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params);
+void gl_trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params);
+void gl_trace_glQueryCounter(GLuint id, GLenum target);
+void gl_trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params);
+void gl_trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params);
+void gl_trace_glVertexAttribDivisor(GLuint index, GLuint divisor);
+void gl_trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void gl_trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void gl_trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+void gl_trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value);
+void gl_trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+
+//GL-trace.cpp defines GL_TRACE_IMPLEMENTATION so that the wrappers can call the real functions:
+#ifndef GL_TRACE_IMPLEMENTATION
+#define glCullFace(...) gl_trace_glCullFace(__VA_ARGS__)
+#define glFrontFace(...) gl_trace_glFrontFace(__VA_ARGS__)
+#define glHint(...) gl_trace_glHint(__VA_ARGS__)
+#define glLineWidth(...) gl_trace_glLineWidth(__VA_ARGS__)
+#define glPointSize(...) gl_trace_glPointSize(__VA_ARGS__)
+#define glPolygonMode(...) gl_trace_glPolygonMode(__VA_ARGS__)
+#define glScissor(...) gl_trace_glScissor(__VA_ARGS__)
+#define glTexParameterf(...) gl_trace_glTexParameterf(__VA_ARGS__)
+#define glTexParameterfv(...) gl_trace_glTexParameterfv(__VA_ARGS__)
+#define glTexParameteri(...) gl_trace_glTexParameteri(__VA_ARGS__)
+#define glTexParameteriv(...) gl_trace_glTexParameteriv(__VA_ARGS__)
+#define glTexImage1D(...) gl_trace_glTexImage1D(__VA_ARGS__)
+#define glTexImage2D(...) gl_trace_glTexImage2D(__VA_ARGS__)
+#define glDrawBuffer(...) gl_trace_glDrawBuffer(__VA_ARGS__)
+#define glClear(...) gl_trace_glClear(__VA_ARGS__)
+#define glClearColor(...) gl_trace_glClearColor(__VA_ARGS__)
+#define glClearStencil(...) gl_trace_glClearStencil(__VA_ARGS__)
+#define glClearDepth(...) gl_trace_glClearDepth(__VA_ARGS__)
+#define glStencilMask(...) gl_trace_glStencilMask(__VA_ARGS__)
+#define glColorMask(...) gl_trace_glColorMask(__VA_ARGS__)
+#define glDepthMask(...) gl_trace_glDepthMask(__VA_ARGS__)
+#define glDisable(...) gl_trace_glDisable(__VA_ARGS__)
+#define glEnable(...) gl_trace_glEnable(__VA_ARGS__)
+#define glFinish(...) gl_trace_glFinish(__VA_ARGS__)
+#define glFlush(...) gl_trace_glFlush(__VA_ARGS__)
+#define glBlendFunc(...) gl_trace_glBlendFunc(__VA_ARGS__)
+#define glLogicOp(...) gl_trace_glLogicOp(__VA_ARGS__)
+#define glStencilFunc(...) gl_trace_glStencilFunc(__VA_ARGS__)
+#define glStencilOp(...) gl_trace_glStencilOp(__VA_ARGS__)
+#define glDepthFunc(...) gl_trace_glDepthFunc(__VA_ARGS__)
+#define glPixelStoref(...) gl_trace_glPixelStoref(__VA_ARGS__)
+#define glPixelStorei(...) gl_trace_glPixelStorei(__VA_ARGS__)
+#define glReadBuffer(...) gl_trace_glReadBuffer(__VA_ARGS__)
+#define glReadPixels(...) gl_trace_glReadPixels(__VA_ARGS__)
+#define glGetBooleanv(...) gl_trace_glGetBooleanv(__VA_ARGS__)
+#define glGetDoublev(...) gl_trace_glGetDoublev(__VA_ARGS__)
+#define glGetError(...) gl_trace_glGetError(__VA_ARGS__)
+#define glGetFloatv(...) gl_trace_glGetFloatv(__VA_ARGS__)
+#define glGetIntegerv(...) gl_trace_glGetIntegerv(__VA_ARGS__)
+#define glGetString(...) gl_trace_glGetString(__VA_ARGS__)
+#define glGetTexImage(...) gl_trace_glGetTexImage(__VA_ARGS__)
+#define glGetTexParameterfv(...) gl_trace_glGetTexParameterfv(__VA_ARGS__)
+#define glGetTexParameteriv(...) gl_trace_glGetTexParameteriv(__VA_ARGS__)
+#define glGetTexLevelParameterfv(...) gl_trace_glGetTexLevelParameterfv(__VA_ARGS__)
+#define glGetTexLevelParameteriv(...) gl_trace_glGetTexLevelParameteriv(__VA_ARGS__)
+#define glIsEnabled(...) gl_trace_glIsEnabled(__VA_ARGS__)
+#define glDepthRange(...) gl_trace_glDepthRange(__VA_ARGS__)
+#define glViewport(...) gl_trace_glViewport(__VA_ARGS__)
+#define glDrawArrays(...) gl_trace_glDrawArrays(__VA_ARGS__)
+#define glDrawElements(...) gl_trace_glDrawElements(__VA_ARGS__)
+#define glGetPointerv(...) gl_trace_glGetPointerv(__VA_ARGS__)
+#define glPolygonOffset(...) gl_trace_glPolygonOffset(__VA_ARGS__)
+#define glCopyTexImage1D(...) gl_trace_glCopyTexImage1D(__VA_ARGS__)
+#define glCopyTexImage2D(...) gl_trace_glCopyTexImage2D(__VA_ARGS__)
+#define glCopyTexSubImage1D(...) gl_trace_glCopyTexSubImage1D(__VA_ARGS__)
+#define glCopyTexSubImage2D(...) gl_trace_glCopyTexSubImage2D(__VA_ARGS__)
+#define glTexSubImage1D(...) gl_trace_glTexSubImage1D(__VA_ARGS__)
+#define glTexSubImage2D(...) gl_trace_glTexSubImage2D(__VA_ARGS__)
+#define glBindTexture(...) gl_trace_glBindTexture(__VA_ARGS__)
+#define glDeleteTextures(...) gl_trace_glDeleteTextures(__VA_ARGS__)
+#define glGenTextures(...) gl_trace_glGenTextures(__VA_ARGS__)
+#define glIsTexture(...) gl_trace_glIsTexture(__VA_ARGS__)
+#define glDrawRangeElements(...) gl_trace_glDrawRangeElements(__VA_ARGS__)
+#define glTexImage3D(...) gl_trace_glTexImage3D(__VA_ARGS__)
+#define glTexSubImage3D(...) gl_trace_glTexSubImage3D(__VA_ARGS__)
+#define glCopyTexSubImage3D(...) gl_trace_glCopyTexSubImage3D(__VA_ARGS__)
+#define glActiveTexture(...) gl_trace_glActiveTexture(__VA_ARGS__)
+#define glSampleCoverage(...) gl_trace_glSampleCoverage(__VA_ARGS__)
+#define glCompressedTexImage3D(...) gl_trace_glCompressedTexImage3D(__VA_ARGS__)
+#define glCompressedTexImage2D(...) gl_trace_glCompressedTexImage2D(__VA_ARGS__)
+#define glCompressedTexImage1D(...) gl_trace_glCompressedTexImage1D(__VA_ARGS__)
+#define glCompressedTexSubImage3D(...) gl_trace_glCompressedTexSubImage3D(__VA_ARGS__)
+#define glCompressedTexSubImage2D(...) gl_trace_glCompressedTexSubImage2D(__VA_ARGS__)
+#define glCompressedTexSubImage1D(...) gl_trace_glCompressedTexSubImage1D(__VA_ARGS__)
+#define glGetCompressedTexImage(...) gl_trace_glGetCompressedTexImage(__VA_ARGS__)
+#define glBlendFuncSeparate(...) gl_trace_glBlendFuncSeparate(__VA_ARGS__)
+#define glMultiDrawArrays(...) gl_trace_glMultiDrawArrays(__VA_ARGS__)
+#define glMultiDrawElements(...) gl_trace_glMultiDrawElements(__VA_ARGS__)
+#define glPointParameterf(...) gl_trace_glPointParameterf(__VA_ARGS__)
+#define glPointParameterfv(...) gl_trace_glPointParameterfv(__VA_ARGS__)
+#define glPointParameteri(...) gl_trace_glPointParameteri(__VA_ARGS__)
+#define glPointParameteriv(...) gl_trace_glPointParameteriv(__VA_ARGS__)
+#define glBlendColor(...) gl_trace_glBlendColor(__VA_ARGS__)
+#define glBlendEquation(...) gl_trace_glBlendEquation(__VA_ARGS__)
+#define glGenQueries(...) gl_trace_glGenQueries(__VA_ARGS__)
+#define glDeleteQueries(...) gl_trace_glDeleteQueries(__VA_ARGS__)
+#define glIsQuery(...) gl_trace_glIsQuery(__VA_ARGS__)
+#define glBeginQuery(...) gl_trace_glBeginQuery(__VA_ARGS__)
+#define glEndQuery(...) gl_trace_glEndQuery(__VA_ARGS__)
+#define glGetQueryiv(...) gl_trace_glGetQueryiv(__VA_ARGS__)
+#define glGetQueryObjectiv(...) gl_trace_glGetQueryObjectiv(__VA_ARGS__)
+#define glGetQueryObjectuiv(...) gl_trace_glGetQueryObjectuiv(__VA_ARGS__)
+#define glBindBuffer(...) gl_trace_glBindBuffer(__VA_ARGS__)
+#define glDeleteBuffers(...) gl_trace_glDeleteBuffers(__VA_ARGS__)
+#define glGenBuffers(...) gl_trace_glGenBuffers(__VA_ARGS__)
+#define glIsBuffer(...) gl_trace_glIsBuffer(__VA_ARGS__)
+#define glBufferData(...) gl_trace_glBufferData(__VA_ARGS__)
+#define glBufferSubData(...) gl_trace_glBufferSubData(__VA_ARGS__)
+#define glGetBufferSubData(...) gl_trace_glGetBufferSubData(__VA_ARGS__)
+#define glMapBuffer(...) gl_trace_glMapBuffer(__VA_ARGS__)
+#define glUnmapBuffer(...) gl_trace_glUnmapBuffer(__VA_ARGS__)
+#define glGetBufferParameteriv(...) gl_trace_glGetBufferParameteriv(__VA_ARGS__)
+#define glGetBufferPointerv(...) gl_trace_glGetBufferPointerv(__VA_ARGS__)
+#define glBlendEquationSeparate(...) gl_trace_glBlendEquationSeparate(__VA_ARGS__)
+#define glDrawBuffers(...) gl_trace_glDrawBuffers(__VA_ARGS__)
+#define glStencilOpSeparate(...) gl_trace_glStencilOpSeparate(__VA_ARGS__)
+#define glStencilFuncSeparate(...) gl_trace_glStencilFuncSeparate(__VA_ARGS__)
+#define glStencilMaskSeparate(...) gl_trace_glStencilMaskSeparate(__VA_ARGS__)
+#define glAttachShader(...) gl_trace_glAttachShader(__VA_ARGS__)
+#define glBindAttribLocation(...) gl_trace_glBindAttribLocation(__VA_ARGS__)
+#define glCompileShader(...) gl_trace_glCompileShader(__VA_ARGS__)
+#define glCreateProgram(...) gl_trace_glCreateProgram(__VA_ARGS__)
+#define glCreateShader(...) gl_trace_glCreateShader(__VA_ARGS__)
+#define glDeleteProgram(...) gl_trace_glDeleteProgram(__VA_ARGS__)
+#define glDeleteShader(...) gl_trace_glDeleteShader(__VA_ARGS__)
+#define glDetachShader(...) gl_trace_glDetachShader(__VA_ARGS__)
+#define glDisableVertexAttribArray(...) gl_trace_glDisableVertexAttribArray(__VA_ARGS__)
+#define glEnableVertexAttribArray(...) gl_trace_glEnableVertexAttribArray(__VA_ARGS__)
+#define glGetActiveAttrib(...) gl_trace_glGetActiveAttrib(__VA_ARGS__)
+#define glGetActiveUniform(...) gl_trace_glGetActiveUniform(__VA_ARGS__)
+#define glGetAttachedShaders(...) gl_trace_glGetAttachedShaders(__VA_ARGS__)
+#define glGetAttribLocation(...) gl_trace_glGetAttribLocation(__VA_ARGS__)
+#define glGetProgramiv(...) gl_trace_glGetProgramiv(__VA_ARGS__)
+#define glGetProgramInfoLog(...) gl_trace_glGetProgramInfoLog(__VA_ARGS__)
+#define glGetShaderiv(...) gl_trace_glGetShaderiv(__VA_ARGS__)
+#define glGetShaderInfoLog(...) gl_trace_glGetShaderInfoLog(__VA_ARGS__)
+#define glGetShaderSource(...) gl_trace_glGetShaderSource(__VA_ARGS__)
+#define glGetUniformLocation(...) gl_trace_glGetUniformLocation(__VA_ARGS__)
+#define glGetUniformfv(...) gl_trace_glGetUniformfv(__VA_ARGS__)
+#define glGetUniformiv(...) gl_trace_glGetUniformiv(__VA_ARGS__)
+#define glGetVertexAttribdv(...) gl_trace_glGetVertexAttribdv(__VA_ARGS__)
+#define glGetVertexAttribfv(...) gl_trace_glGetVertexAttribfv(__VA_ARGS__)
+#define glGetVertexAttribiv(...) gl_trace_glGetVertexAttribiv(__VA_ARGS__)
+#define glGetVertexAttribPointerv(...) gl_trace_glGetVertexAttribPointerv(__VA_ARGS__)
+#define glIsProgram(...) gl_trace_glIsProgram(__VA_ARGS__)
+#define glIsShader(...) gl_trace_glIsShader(__VA_ARGS__)
+#define glLinkProgram(...) gl_trace_glLinkProgram(__VA_ARGS__)
+#define glShaderSource(...) gl_trace_glShaderSource(__VA_ARGS__)
+#define glUseProgram(...) gl_trace_glUseProgram(__VA_ARGS__)
+#define glUniform1f(...) gl_trace_glUniform1f(__VA_ARGS__)
+#define glUniform2f(...) gl_trace_glUniform2f(__VA_ARGS__)
+#define glUniform3f(...) gl_trace_glUniform3f(__VA_ARGS__)
+#define glUniform4f(...) gl_trace_glUniform4f(__VA_ARGS__)
+#define glUniform1i(...) gl_trace_glUniform1i(__VA_ARGS__)
+#define glUniform2i(...) gl_trace_glUniform2i(__VA_ARGS__)
+#define glUniform3i(...) gl_trace_glUniform3i(__VA_ARGS__)
+#define glUniform4i(...) gl_trace_glUniform4i(__VA_ARGS__)
+#define glUniform1fv(...) gl_trace_glUniform1fv(__VA_ARGS__)
+#define glUniform2fv(...) gl_trace_glUniform2fv(__VA_ARGS__)
+#define glUniform3fv(...) gl_trace_glUniform3fv(__VA_ARGS__)
+#define glUniform4fv(...) gl_trace_glUniform4fv(__VA_ARGS__)
+#define glUniform1iv(...) gl_trace_glUniform1iv(__VA_ARGS__)
+#define glUniform2iv(...) gl_trace_glUniform2iv(__VA_ARGS__)
+#define glUniform3iv(...) gl_trace_glUniform3iv(__VA_ARGS__)
+#define glUniform4iv(...) gl_trace_glUniform4iv(__VA_ARGS__)
+#define glUniformMatrix2fv(...) gl_trace_glUniformMatrix2fv(__VA_ARGS__)
+#define glUniformMatrix3fv(...) gl_trace_glUniformMatrix3fv(__VA_ARGS__)
+#define glUniformMatrix4fv(...) gl_trace_glUniformMatrix4fv(__VA_ARGS__)
+#define glValidateProgram(...) gl_trace_glValidateProgram(__VA_ARGS__)
+#define glVertexAttrib1d(...) gl_trace_glVertexAttrib1d(__VA_ARGS__)
+#define glVertexAttrib1dv(...) gl_trace_glVertexAttrib1dv(__VA_ARGS__)
+#define glVertexAttrib1f(...) gl_trace_glVertexAttrib1f(__VA_ARGS__)
+#define glVertexAttrib1fv(...) gl_trace_glVertexAttrib1fv(__VA_ARGS__)
+#define glVertexAttrib1s(...) gl_trace_glVertexAttrib1s(__VA_ARGS__)
+#define glVertexAttrib1sv(...) gl_trace_glVertexAttrib1sv(__VA_ARGS__)
+#define glVertexAttrib2d(...) gl_trace_glVertexAttrib2d(__VA_ARGS__)
+#define glVertexAttrib2dv(...) gl_trace_glVertexAttrib2dv(__VA_ARGS__)
+#define glVertexAttrib2f(...) gl_trace_glVertexAttrib2f(__VA_ARGS__)
+#define glVertexAttrib2fv(...) gl_trace_glVertexAttrib2fv(__VA_ARGS__)
+#define glVertexAttrib2s(...) gl_trace_glVertexAttrib2s(__VA_ARGS__)
+#define glVertexAttrib2sv(...) gl_trace_glVertexAttrib2sv(__VA_ARGS__)
+#define glVertexAttrib3d(...) gl_trace_glVertexAttrib3d(__VA_ARGS__)
+#define glVertexAttrib3dv(...) gl_trace_glVertexAttrib3dv(__VA_ARGS__)
+#define glVertexAttrib3f(...) gl_trace_glVertexAttrib3f(__VA_ARGS__)
+#define glVertexAttrib3fv(...) gl_trace_glVertexAttrib3fv(__VA_ARGS__)
+#define glVertexAttrib3s(...) gl_trace_glVertexAttrib3s(__VA_ARGS__)
+#define glVertexAttrib3sv(...) gl_trace_glVertexAttrib3sv(__VA_ARGS__)
+#define glVertexAttrib4Nbv(...) gl_trace_glVertexAttrib4Nbv(__VA_ARGS__)
+#define glVertexAttrib4Niv(...) gl_trace_glVertexAttrib4Niv(__VA_ARGS__)
+#define glVertexAttrib4Nsv(...) gl_trace_glVertexAttrib4Nsv(__VA_ARGS__)
+#define glVertexAttrib4Nub(...) gl_trace_glVertexAttrib4Nub(__VA_ARGS__)
+#define glVertexAttrib4Nubv(...) gl_trace_glVertexAttrib4Nubv(__VA_ARGS__)
+#define glVertexAttrib4Nuiv(...) gl_trace_glVertexAttrib4Nuiv(__VA_ARGS__)
+#define glVertexAttrib4Nusv(...) gl_trace_glVertexAttrib4Nusv(__VA_ARGS__)
+#define glVertexAttrib4bv(...) gl_trace_glVertexAttrib4bv(__VA_ARGS__)
+#define glVertexAttrib4d(...) gl_trace_glVertexAttrib4d(__VA_ARGS__)
+#define glVertexAttrib4dv(...) gl_trace_glVertexAttrib4dv(__VA_ARGS__)
+#define glVertexAttrib4f(...) gl_trace_glVertexAttrib4f(__VA_ARGS__)
+#define glVertexAttrib4fv(...) gl_trace_glVertexAttrib4fv(__VA_ARGS__)
+#define glVertexAttrib4iv(...) gl_trace_glVertexAttrib4iv(__VA_ARGS__)
+#define glVertexAttrib4s(...) gl_trace_glVertexAttrib4s(__VA_ARGS__)
+#define glVertexAttrib4sv(...) gl_trace_glVertexAttrib4sv(__VA_ARGS__)
+#define glVertexAttrib4ubv(...) gl_trace_glVertexAttrib4ubv(__VA_ARGS__)
+#define glVertexAttrib4uiv(...) gl_trace_glVertexAttrib4uiv(__VA_ARGS__)
+#define glVertexAttrib4usv(...) gl_trace_glVertexAttrib4usv(__VA_ARGS__)
+#define glVertexAttribPointer(...) gl_trace_glVertexAttribPointer(__VA_ARGS__)
+#define glUniformMatrix2x3fv(...) gl_trace_glUniformMatrix2x3fv(__VA_ARGS__)
+#define glUniformMatrix3x2fv(...) gl_trace_glUniformMatrix3x2fv(__VA_ARGS__)
+#define glUniformMatrix2x4fv(...) gl_trace_glUniformMatrix2x4fv(__VA_ARGS__)
+#define glUniformMatrix4x2fv(...) gl_trace_glUniformMatrix4x2fv(__VA_ARGS__)
+#define glUniformMatrix3x4fv(...) gl_trace_glUniformMatrix3x4fv(__VA_ARGS__)
+#define glUniformMatrix4x3fv(...) gl_trace_glUniformMatrix4x3fv(__VA_ARGS__)
+#define glColorMaski(...) gl_trace_glColorMaski(__VA_ARGS__)
+#define glGetBooleani_v(...) gl_trace_glGetBooleani_v(__VA_ARGS__)
+#define glGetIntegeri_v(...) gl_trace_glGetIntegeri_v(__VA_ARGS__)
+#define glEnablei(...) gl_trace_glEnablei(__VA_ARGS__)
+#define glDisablei(...) gl_trace_glDisablei(__VA_ARGS__)
+#define glIsEnabledi(...) gl_trace_glIsEnabledi(__VA_ARGS__)
+#define glBeginTransformFeedback(...) gl_trace_glBeginTransformFeedback(__VA_ARGS__)
+#define glEndTransformFeedback(...) gl_trace_glEndTransformFeedback(__VA_ARGS__)
+#define glBindBufferRange(...) gl_trace_glBindBufferRange(__VA_ARGS__)
+#define glBindBufferBase(...) gl_trace_glBindBufferBase(__VA_ARGS__)
+#define glTransformFeedbackVaryings(...) gl_trace_glTransformFeedbackVaryings(__VA_ARGS__)
+#define glGetTransformFeedbackVarying(...) gl_trace_glGetTransformFeedbackVarying(__VA_ARGS__)
+#define glClampColor(...) gl_trace_glClampColor(__VA_ARGS__)
+#define glBeginConditionalRender(...) gl_trace_glBeginConditionalRender(__VA_ARGS__)
+#define glEndConditionalRender(...) gl_trace_glEndConditionalRender(__VA_ARGS__)
+#define glVertexAttribIPointer(...) gl_trace_glVertexAttribIPointer(__VA_ARGS__)
+#define glGetVertexAttribIiv(...) gl_trace_glGetVertexAttribIiv(__VA_ARGS__)
+#define glGetVertexAttribIuiv(...) gl_trace_glGetVertexAttribIuiv(__VA_ARGS__)
+#define glVertexAttribI1i(...) gl_trace_glVertexAttribI1i(__VA_ARGS__)
+#define glVertexAttribI2i(...) gl_trace_glVertexAttribI2i(__VA_ARGS__)
+#define glVertexAttribI3i(...) gl_trace_glVertexAttribI3i(__VA_ARGS__)
+#define glVertexAttribI4i(...) gl_trace_glVertexAttribI4i(__VA_ARGS__)
+#define glVertexAttribI1ui(...) gl_trace_glVertexAttribI1ui(__VA_ARGS__)
+#define glVertexAttribI2ui(...) gl_trace_glVertexAttribI2ui(__VA_ARGS__)
+#define glVertexAttribI3ui(...) gl_trace_glVertexAttribI3ui(__VA_ARGS__)
+#define glVertexAttribI4ui(...) gl_trace_glVertexAttribI4ui(__VA_ARGS__)
+#define glVertexAttribI1iv(...) gl_trace_glVertexAttribI1iv(__VA_ARGS__)
+#define glVertexAttribI2iv(...) gl_trace_glVertexAttribI2iv(__VA_ARGS__)
+#define glVertexAttribI3iv(...) gl_trace_glVertexAttribI3iv(__VA_ARGS__)
+#define glVertexAttribI4iv(...) gl_trace_glVertexAttribI4iv(__VA_ARGS__)
+#define glVertexAttribI1uiv(...) gl_trace_glVertexAttribI1uiv(__VA_ARGS__)
+#define glVertexAttribI2uiv(...) gl_trace_glVertexAttribI2uiv(__VA_ARGS__)
+#define glVertexAttribI3uiv(...) gl_trace_glVertexAttribI3uiv(__VA_ARGS__)
+#define glVertexAttribI4uiv(...) gl_trace_glVertexAttribI4uiv(__VA_ARGS__)
+#define glVertexAttribI4bv(...) gl_trace_glVertexAttribI4bv(__VA_ARGS__)
+#define glVertexAttribI4sv(...) gl_trace_glVertexAttribI4sv(__VA_ARGS__)
+#define glVertexAttribI4ubv(...) gl_trace_glVertexAttribI4ubv(__VA_ARGS__)
+#define glVertexAttribI4usv(...) gl_trace_glVertexAttribI4usv(__VA_ARGS__)
+#define glGetUniformuiv(...) gl_trace_glGetUniformuiv(__VA_ARGS__)
+#define glBindFragDataLocation(...) gl_trace_glBindFragDataLocation(__VA_ARGS__)
+#define glGetFragDataLocation(...) gl_trace_glGetFragDataLocation(__VA_ARGS__)
+#define glUniform1ui(...) gl_trace_glUniform1ui(__VA_ARGS__)
+#define glUniform2ui(...) gl_trace_glUniform2ui(__VA_ARGS__)
+#define glUniform3ui(...) gl_trace_glUniform3ui(__VA_ARGS__)
+#define glUniform4ui(...) gl_trace_glUniform4ui(__VA_ARGS__)
+#define glUniform1uiv(...) gl_trace_glUniform1uiv(__VA_ARGS__)
+#define glUniform2uiv(...) gl_trace_glUniform2uiv(__VA_ARGS__)
+#define glUniform3uiv(...) gl_trace_glUniform3uiv(__VA_ARGS__)
+#define glUniform4uiv(...) gl_trace_glUniform4uiv(__VA_ARGS__)
+#define glTexParameterIiv(...) gl_trace_glTexParameterIiv(__VA_ARGS__)
+#define glTexParameterIuiv(...) gl_trace_glTexParameterIuiv(__VA_ARGS__)
+#define glGetTexParameterIiv(...) gl_trace_glGetTexParameterIiv(__VA_ARGS__)
+#define glGetTexParameterIuiv(...) gl_trace_glGetTexParameterIuiv(__VA_ARGS__)
+#define glClearBufferiv(...) gl_trace_glClearBufferiv(__VA_ARGS__)
+#define glClearBufferuiv(...) gl_trace_glClearBufferuiv(__VA_ARGS__)
+#define glClearBufferfv(...) gl_trace_glClearBufferfv(__VA_ARGS__)
+#define glClearBufferfi(...) gl_trace_glClearBufferfi(__VA_ARGS__)
+#define glGetStringi(...) gl_trace_glGetStringi(__VA_ARGS__)
+#define glIsRenderbuffer(...) gl_trace_glIsRenderbuffer(__VA_ARGS__)
+#define glBindRenderbuffer(...) gl_trace_glBindRenderbuffer(__VA_ARGS__)
+#define glDeleteRenderbuffers(...) gl_trace_glDeleteRenderbuffers(__VA_ARGS__)
+#define glGenRenderbuffers(...) gl_trace_glGenRenderbuffers(__VA_ARGS__)
+#define glRenderbufferStorage(...) gl_trace_glRenderbufferStorage(__VA_ARGS__)
+#define glGetRenderbufferParameteriv(...) gl_trace_glGetRenderbufferParameteriv(__VA_ARGS__)
+#define glIsFramebuffer(...) gl_trace_glIsFramebuffer(__VA_ARGS__)
+#define glBindFramebuffer(...) gl_trace_glBindFramebuffer(__VA_ARGS__)
+#define glDeleteFramebuffers(...) gl_trace_glDeleteFramebuffers(__VA_ARGS__)
+#define glGenFramebuffers(...) gl_trace_glGenFramebuffers(__VA_ARGS__)
+#define glCheckFramebufferStatus(...) gl_trace_glCheckFramebufferStatus(__VA_ARGS__)
+#define glFramebufferTexture1D(...) gl_trace_glFramebufferTexture1D(__VA_ARGS__)
+#define glFramebufferTexture2D(...) gl_trace_glFramebufferTexture2D(__VA_ARGS__)
+#define glFramebufferTexture3D(...) gl_trace_glFramebufferTexture3D(__VA_ARGS__)
+#define glFramebufferRenderbuffer(...) gl_trace_glFramebufferRenderbuffer(__VA_ARGS__)
+#define glGetFramebufferAttachmentParameteriv(...) gl_trace_glGetFramebufferAttachmentParameteriv(__VA_ARGS__)
+#define glGenerateMipmap(...) gl_trace_glGenerateMipmap(__VA_ARGS__)
+#define glBlitFramebuffer(...) gl_trace_glBlitFramebuffer(__VA_ARGS__)
+#define glRenderbufferStorageMultisample(...) gl_trace_glRenderbufferStorageMultisample(__VA_ARGS__)
+#define glFramebufferTextureLayer(...) gl_trace_glFramebufferTextureLayer(__VA_ARGS__)
+#define glMapBufferRange(...) gl_trace_glMapBufferRange(__VA_ARGS__)
+#define glFlushMappedBufferRange(...) gl_trace_glFlushMappedBufferRange(__VA_ARGS__)
+#define glBindVertexArray(...) gl_trace_glBindVertexArray(__VA_ARGS__)
+#define glDeleteVertexArrays(...) gl_trace_glDeleteVertexArrays(__VA_ARGS__)
+#define glGenVertexArrays(...) gl_trace_glGenVertexArrays(__VA_ARGS__)
+#define glIsVertexArray(...) gl_trace_glIsVertexArray(__VA_ARGS__)
+#define glDrawArraysInstanced(...) gl_trace_glDrawArraysInstanced(__VA_ARGS__)
+#define glDrawElementsInstanced(...) gl_trace_glDrawElementsInstanced(__VA_ARGS__)
+#define glTexBuffer(...) gl_trace_glTexBuffer(__VA_ARGS__)
+#define glPrimitiveRestartIndex(...) gl_trace_glPrimitiveRestartIndex(__VA_ARGS__)
+#define glCopyBufferSubData(...) gl_trace_glCopyBufferSubData(__VA_ARGS__)
+#define glGetUniformIndices(...) gl_trace_glGetUniformIndices(__VA_ARGS__)
+#define glGetActiveUniformsiv(...) gl_trace_glGetActiveUniformsiv(__VA_ARGS__)
+#define glGetActiveUniformName(...) gl_trace_glGetActiveUniformName(__VA_ARGS__)
+#define glGetUniformBlockIndex(...) gl_trace_glGetUniformBlockIndex(__VA_ARGS__)
+#define glGetActiveUniformBlockiv(...) gl_trace_glGetActiveUniformBlockiv(__VA_ARGS__)
+#define glGetActiveUniformBlockName(...) gl_trace_glGetActiveUniformBlockName(__VA_ARGS__)
+#define glUniformBlockBinding(...) gl_trace_glUniformBlockBinding(__VA_ARGS__)
+#define glDrawElementsBaseVertex(...) gl_trace_glDrawElementsBaseVertex(__VA_ARGS__)
+#define glDrawRangeElementsBaseVertex(...) gl_trace_glDrawRangeElementsBaseVertex(__VA_ARGS__)
+#define glDrawElementsInstancedBaseVertex(...) gl_trace_glDrawElementsInstancedBaseVertex(__VA_ARGS__)
+#define glMultiDrawElementsBaseVertex(...) gl_trace_glMultiDrawElementsBaseVertex(__VA_ARGS__)
+#define glProvokingVertex(...) gl_trace_glProvokingVertex(__VA_ARGS__)
+#define glFenceSync(...) gl_trace_glFenceSync(__VA_ARGS__)
+#define glIsSync(...) gl_trace_glIsSync(__VA_ARGS__)
+#define glDeleteSync(...) gl_trace_glDeleteSync(__VA_ARGS__)
+#define glClientWaitSync(...) gl_trace_glClientWaitSync(__VA_ARGS__)
+#define glWaitSync(...) gl_trace_glWaitSync(__VA_ARGS__)
+#define glGetInteger64v(...) gl_trace_glGetInteger64v(__VA_ARGS__)
+#define glGetSynciv(...) gl_trace_glGetSynciv(__VA_ARGS__)
+#define glGetInteger64i_v(...) gl_trace_glGetInteger64i_v(__VA_ARGS__)
+#define glGetBufferParameteri64v(...) gl_trace_glGetBufferParameteri64v(__VA_ARGS__)
+#define glFramebufferTexture(...) gl_trace_glFramebufferTexture(__VA_ARGS__)
+#define glTexImage2DMultisample(...) gl_trace_glTexImage2DMultisample(__VA_ARGS__)
+#define glTexImage3DMultisample(...) gl_trace_glTexImage3DMultisample(__VA_ARGS__)
+#define glGetMultisamplefv(...) gl_trace_glGetMultisamplefv(__VA_ARGS__)
+#define glSampleMaski(...) gl_trace_glSampleMaski(__VA_ARGS__)
+#define glBindFragDataLocationIndexed(...) gl_trace_glBindFragDataLocationIndexed(__VA_ARGS__)
+#define glGetFragDataIndex(...) gl_trace_glGetFragDataIndex(__VA_ARGS__)
+#define glGenSamplers(...) gl_trace_glGenSamplers(__VA_ARGS__)
+#define glDeleteSamplers(...) gl_trace_glDeleteSamplers(__VA_ARGS__)
+#define glIsSampler(...) gl_trace_glIsSampler(__VA_ARGS__)
+#define glBindSampler(...) gl_trace_glBindSampler(__VA_ARGS__)
+#define glSamplerParameteri(...) gl_trace_glSamplerParameteri(__VA_ARGS__)
+#define glSamplerParameteriv(...) gl_trace_glSamplerParameteriv(__VA_ARGS__)
+#define glSamplerParameterf(...) gl_trace_glSamplerParameterf(__VA_ARGS__)
+#define glSamplerParameterfv(...) gl_trace_glSamplerParameterfv(__VA_ARGS__)
+#define glSamplerParameterIiv(...) gl_trace_glSamplerParameterIiv(__VA_ARGS__)
+#define glSamplerParameterIuiv(...) gl_trace_glSamplerParameterIuiv(__VA_ARGS__)
+#define glGetSamplerParameteriv(...) gl_trace_glGetSamplerParameteriv(__VA_ARGS__)
+#define glGetSamplerParameterIiv(...) gl_trace_glGetSamplerParameterIiv(__VA_ARGS__)
+#define glGetSamplerParameterfv(...) gl_trace_glGetSamplerParameterfv(__VA_ARGS__)
+#define glGetSamplerParameterIuiv(...) gl_trace_glGetSamplerParameterIuiv(__VA_ARGS__)
+#define glQueryCounter(...) gl_trace_glQueryCounter(__VA_ARGS__)
+#define glGetQueryObjecti64v(...) gl_trace_glGetQueryObjecti64v(__VA_ARGS__)
+#define glGetQueryObjectui64v(...) gl_trace_glGetQueryObjectui64v(__VA_ARGS__)
+#define glVertexAttribDivisor(...) gl_trace_glVertexAttribDivisor(__VA_ARGS__)
+#define glVertexAttribP1ui(...) gl_trace_glVertexAttribP1ui(__VA_ARGS__)
+#define glVertexAttribP1uiv(...) gl_trace_glVertexAttribP1uiv(__VA_ARGS__)
+#define glVertexAttribP2ui(...) gl_trace_glVertexAttribP2ui(__VA_ARGS__)
+#define glVertexAttribP2uiv(...) gl_trace_glVertexAttribP2uiv(__VA_ARGS__)
+#define glVertexAttribP3ui(...) gl_trace_glVertexAttribP3ui(__VA_ARGS__)
+#define glVertexAttribP3uiv(...) gl_trace_glVertexAttribP3uiv(__VA_ARGS__)
+#define glVertexAttribP4ui(...) gl_trace_glVertexAttribP4ui(__VA_ARGS__)
+#define glVertexAttribP4uiv(...) gl_trace_glVertexAttribP4uiv(__VA_ARGS__)
+#endif
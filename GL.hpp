@@ -1277,3 +1277,8 @@ GLAPI void (APIENTRYFP glVertexAttribP4ui) (GLuint index, GLenum type, GLboolean
 GLAPI void (APIENTRYFP glVertexAttribP4uiv) (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
 
 }
+
+//when building with GL_TRACE defined, every gl* call goes through a counting wrapper:
+#ifdef GL_TRACE
+#include "GL-trace.hpp"
+#endif
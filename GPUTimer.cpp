@@ -0,0 +1,99 @@
+#include "GPUTimer.hpp"
+
+#include "GL.hpp"
+#include "gl_errors.hpp"
+#include "Profiler.hpp"
+
+#include <array>
+
+bool GPUTimer::enabled = true;
+
+namespace {
+	struct Query {
+		char const *name;
+		GLuint query;
+		uint64_t cpu_begin_ns; //when the section was issued (used to place it in traces)
+	};
+
+	//all of the queries issued during one frame:
+	struct QuerySet {
+		std::vector< GLuint > pool; //query objects owned by this set (grows as needed)
+		std::vector< Query > queries; //queries issued (uses pool[0 .. queries.size()-1])
+		bool skip = false; //set if this set's old results weren't ready when the frame started
+	};
+	std::array< QuerySet, 2 > sets;
+	uint32_t current = 0; //set being issued this frame
+
+	uint32_t depth = 0; //nesting depth of begin()/end()
+	bool active = false; //is a GL_TIME_ELAPSED query running?
+
+	std::vector< GPUTimer::Section > latest;
+
+	Profiler::Track *track() {
+		static Profiler::Track *gpu_track = Profiler::make_track("GPU");
+		return gpu_track;
+	}
+
+	//read back a set's results if all of them are ready; returns false if some aren't:
+	bool collect(QuerySet &set) {
+		if (set.queries.empty()) return true;
+
+		for (Query const &query : set.queries) {
+			GLuint available = GL_FALSE;
+			glGetQueryObjectuiv(query.query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available) return false;
+		}
+
+		latest.clear();
+		for (Query const &query : set.queries) {
+			GLuint64 elapsed_ns = 0;
+			glGetQueryObjectui64v(query.query, GL_QUERY_RESULT, &elapsed_ns);
+			latest.emplace_back(GPUTimer::Section{query.name, float(elapsed_ns) * 1e-6f});
+			Profiler::record(track(), query.name, query.cpu_begin_ns, query.cpu_begin_ns + elapsed_ns);
+		}
+		set.queries.clear();
+		return true;
+	}
+}
+
+void GPUTimer::begin(char const *name) {
+	depth += 1;
+	if (depth > 1) return; //nested; folded into outer section
+	if (!enabled) return;
+
+	QuerySet &set = sets[current];
+	if (set.skip) return;
+
+	if (set.queries.size() == set.pool.size()) {
+		set.pool.emplace_back(0);
+		glGenQueries(1, &set.pool.back());
+	}
+	GLuint query = set.pool[set.queries.size()];
+	set.queries.emplace_back(Query{name, query, Profiler::now_ns()});
+	glBeginQuery(GL_TIME_ELAPSED, query);
+	active = true;
+}
+
+void GPUTimer::end() {
+	if (depth == 0) return; //unbalanced end()
+	depth -= 1;
+	if (depth > 0) return;
+	if (active) {
+		glEndQuery(GL_TIME_ELAPSED);
+		active = false;
+	}
+}
+
+void GPUTimer::end_frame() {
+	current = (current + 1) % sets.size();
+
+	//the set about to be reused holds the frame-before-last's queries:
+	QuerySet &set = sets[current];
+	set.skip = !collect(set);
+
+	GL_ERRORS();
+}
+
+std::vector< GPUTimer::Section > const &GPUTimer::results() {
+	return latest;
+}
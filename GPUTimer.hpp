@@ -0,0 +1,60 @@
+#pragma once
+
+/*
+ * GPUTimer measures how long the GPU spends on named sections of a frame,
+ *  using GL_TIME_ELAPSED queries:
+ *
+ * void Scene::draw(...) {
+ *     GPU_ZONE("Scene::draw");
+ *     ... GL calls ...
+ * }
+ *
+ * Query results are read one frame late from a second set of queries
+ *  (double-buffering), and only once the GPU reports them available, so
+ *  timing never makes the CPU wait on the GPU. If a frame's results still
+ *  aren't ready when its query set comes around again, the next frame is
+ *  simply not timed.
+ *
+ * GL_TIME_ELAPSED queries can't nest, so sections don't either: a section
+ *  begun inside another section is folded into the outer one.
+ *
+ * Finished sections are available from results(), and are also recorded to a
+ *  "GPU" Profiler track (positioned at the CPU time the section was issued).
+ *
+ */
+
+#include <cstdint>
+#include <vector>
+
+namespace GPUTimer {
+	//is timing turned on? (changes take effect at the next section)
+	extern bool enabled;
+
+	//mark a section (prefer GPU_ZONE):
+	// (name must outlive the timer -- in practice, it's a string literal)
+	void begin(char const *name);
+	void end();
+
+	//called by the main loop once all of a frame's drawing has been issued:
+	// (switches query sets and collects any results that are ready)
+	void end_frame();
+
+	//sections from the most recent frame with results:
+	struct Section {
+		char const *name;
+		float ms;
+	};
+	std::vector< Section > const &results();
+
+	//RAII helper used by GPU_ZONE:
+	struct Scope {
+		Scope(char const *name) { begin(name); }
+		~Scope() { end(); }
+		Scope(Scope const &) = delete;
+		Scope &operator=(Scope const &) = delete;
+	};
+}
+
+#define GPU_ZONE_CAT2(A, B) A ## B
+#define GPU_ZONE_CAT(A, B) GPU_ZONE_CAT2(A, B)
+#define GPU_ZONE(NAME) GPUTimer::Scope GPU_ZONE_CAT(gpu_zone_, __LINE__)(NAME)
@@ -0,0 +1,259 @@
+#include "Impostor.hpp"
+#include "ImpostorBakeProgram.hpp"
+#include "ImpostorProgram.hpp"
+
+#include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
+#include "Profiler.hpp"
+#include "mipmaps.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+//atlas texture (filled by rendering into level 0; see make_view_mipmaps for the rest):
+static GLuint make_atlas(GLenum internal_format, uint32_t width, uint32_t height) {
+	GLuint texture = 0;
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, internal_format, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return texture;
+}
+
+//premultiply 'texture's level 0 and build the smaller levels from it one view at a time:
+// (glGenerateMipmap would average neighboring views together at every level, and blend uncovered (0,0,0,0) pixels in as black)
+static void make_view_mipmaps(GLuint texture, GLenum internal_format, uint32_t views, uint32_t cell) {
+	uint32_t width = views * cell;
+	std::vector< glm::u8vec4 > atlas(size_t(width) * cell);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, atlas.data());
+
+	for (glm::u8vec4 &px : atlas) {
+		px = glm::u8vec4((glm::uvec3(px) * uint32_t(px.a) + 127u) / 255u, px.a);
+	}
+
+	//levels[l] is the whole atlas at level l (views side by side, each (cell >> l) pixels square):
+	uint32_t level_count = 1;
+	while ((cell >> level_count) != 0) ++level_count;
+	std::vector< std::vector< glm::u8vec4 > > levels(level_count);
+	levels[0] = atlas;
+	for (uint32_t l = 1; l < level_count; ++l) {
+		levels[l].resize(size_t(width >> l) * (cell >> l));
+	}
+
+	std::vector< glm::u8vec4 > pixels;
+	for (uint32_t v = 0; v < views; ++v) {
+		pixels.clear();
+		for (uint32_t y = 0; y < cell; ++y) {
+			auto row = atlas.begin() + size_t(y) * width + size_t(v) * cell;
+			pixels.insert(pixels.end(), row, row + cell);
+		}
+		std::vector< glm::uvec2 > sizes = make_mipmaps(glm::uvec2(cell), &pixels);
+		assert(sizes.size() == level_count);
+		size_t offset = 0;
+		for (uint32_t l = 0; l < level_count; ++l) {
+			uint32_t size = sizes[l].x;
+			if (l > 0) {
+				for (uint32_t y = 0; y < size; ++y) {
+					std::copy(pixels.begin() + offset + size_t(y) * size, pixels.begin() + offset + size_t(y + 1) * size,
+						levels[l].begin() + size_t(y) * (width >> l) + size_t(v) * size);
+				}
+			}
+			offset += size_t(size) * size;
+		}
+	}
+
+	//the chain stops when views are a pixel tall (the atlas is still 'views' wide there):
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(level_count - 1));
+	for (uint32_t l = 0; l < level_count; ++l) {
+		glTexImage2D(GL_TEXTURE_2D, l, internal_format, width >> l, cell >> l, 0, GL_RGBA, GL_UNSIGNED_BYTE, levels[l].data());
+		PerfStats::count_upload(levels[l].size() * sizeof(glm::u8vec4));
+	}
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+Impostor::Impostor(Mesh const &mesh, GLuint vao, uint32_t views_, uint32_t cell_) : views(views_), cell(cell_) {
+	PROFILE_ZONE("Impostor::bake");
+
+	if (views == 0 || cell == 0) throw std::runtime_error("Impostor needs at least one view of at least one pixel.");
+	if ((cell & (cell - 1)) != 0) throw std::runtime_error("Impostor cell size must be a power of two.");
+	if (!(mesh.min.x <= mesh.max.x)) throw std::runtime_error("Impostor mesh has no bounds.");
+
+	center = 0.5f * glm::vec2(mesh.min + mesh.max);
+	radius = std::max(0.5f * glm::length(glm::vec2(mesh.max - mesh.min)), 1e-6f);
+	height = glm::vec2(mesh.min.z, std::max(mesh.max.z, mesh.min.z + 1e-6f));
+
+	uint32_t width = views * cell;
+	color_texture = make_atlas(GL_SRGB8_ALPHA8, width, cell);
+	normal_texture = make_atlas(GL_RGBA8, width, cell);
+
+	GLuint depth = 0;
+	glGenRenderbuffers(1, &depth);
+	glBindRenderbuffer(GL_RENDERBUFFER, depth);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, cell);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	//save the state this changes:
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	GLint draw_framebuffer = 0, read_framebuffer = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_framebuffer);
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_framebuffer);
+	GLfloat clear_color[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, clear_color);
+	GLboolean depth_test = glIsEnabled(GL_DEPTH_TEST);
+	GLboolean blend = glIsEnabled(GL_BLEND);
+
+	GLuint framebuffer = 0;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_texture, 0);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, normal_texture, 0);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+	GLenum draw_buffers[2] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+	glDrawBuffers(2, draw_buffers);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		throw std::runtime_error("Impostor bake framebuffer is incomplete.");
+	}
+
+	glViewport(0, 0, width, cell);
+	glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+	glClearDepth(1.0f);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glDisable(GL_BLEND);
+
+	glUseProgram(impostor_bake_program->program);
+	glBindVertexArray(vao);
+
+	//view i looks at the mesh from angle i * 2pi / views (in the xy plane), orthographically,
+	// framing the same [center +/- radius] x [height] area that ImpostorProgram's quads cover:
+	constexpr float Tau = 6.28318530718f;
+	for (uint32_t i = 0; i < views; ++i) {
+		float angle = i * Tau / views;
+		glm::vec2 right = glm::vec2(-std::sin(angle), std::cos(angle));
+		glm::vec2 toward = glm::vec2(std::cos(angle), std::sin(angle)); //(toward the viewer)
+		float sy = 2.0f / (height.y - height.x);
+
+		glm::mat4 clip_from_object = glm::mat4(
+			glm::vec4(right.x / radius, 0.0f, -toward.x / radius, 0.0f),
+			glm::vec4(right.y / radius, 0.0f, -toward.y / radius, 0.0f),
+			glm::vec4(0.0f, sy, 0.0f, 0.0f),
+			glm::vec4(-glm::dot(right, center) / radius, -1.0f - sy * height.x, glm::dot(toward, center) / radius, 1.0f)
+		);
+
+		glViewport(i * cell, 0, cell, cell);
+		glUniformMatrix4fv(impostor_bake_program->CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_object));
+		glDrawArrays(mesh.type, mesh.start, mesh.count);
+		PerfStats::count_draw(mesh.type, mesh.count);
+	}
+
+	glBindVertexArray(0);
+	glUseProgram(0);
+
+	//restore state:
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, read_framebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, draw_framebuffer);
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	glClearColor(clear_color[0], clear_color[1], clear_color[2], clear_color[3]);
+	if (!depth_test) glDisable(GL_DEPTH_TEST);
+	if (blend) glEnable(GL_BLEND);
+
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteRenderbuffers(1, &depth);
+
+	make_view_mipmaps(color_texture, GL_SRGB8_ALPHA8, views, cell);
+	make_view_mipmaps(normal_texture, GL_RGBA8, views, cell);
+
+	//per-instance attributes come from instance_buffer (four vertices per instance come from gl_VertexID):
+	glGenBuffers(1, &instance_buffer);
+	glGenVertexArrays(1, &instance_vao);
+	glBindVertexArray(instance_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+	glVertexAttribPointer(impostor_program->Placement_vec4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLbyte *)0 + offsetof(Instance, placement));
+	glEnableVertexAttribArray(impostor_program->Placement_vec4);
+	glVertexAttribDivisor(impostor_program->Placement_vec4, 1);
+	glVertexAttribPointer(impostor_program->Scale_float, 1, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLbyte *)0 + offsetof(Instance, scale));
+	glEnableVertexAttribArray(impostor_program->Scale_float);
+	glVertexAttribDivisor(impostor_program->Scale_float, 1);
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	GL_ERRORS();
+}
+
+Impostor::~Impostor() {
+	glDeleteVertexArrays(1, &instance_vao);
+	glDeleteBuffers(1, &instance_buffer);
+	glDeleteTextures(1, &normal_texture);
+	glDeleteTextures(1, &color_texture);
+}
+
+void Impostor::add(glm::mat4x3 const &world_from_object) const {
+	Instance instance;
+	glm::vec3 const &x = world_from_object[0];
+	instance.placement = glm::vec4(world_from_object[3], std::atan2(x.y, x.x));
+	instance.scale = glm::length(x);
+	instances.emplace_back(instance);
+}
+
+void Impostor::draw(glm::mat4 const &clip_from_world, glm::vec3 const &eye, Scene::Light const *light) const {
+	if (instances.empty()) return;
+
+	GPU_ZONE("Impostor");
+
+	glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+	glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, instances.size() * sizeof(Instance), instances.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	PerfStats::count_upload(instances.size() * sizeof(Instance));
+
+	//shade as LitColorTextureProgram does for a hemisphere light:
+	//(with no light, a zero direction makes the shader's dot(n,-LIGHT_DIRECTION) * 0.5 + 0.5 a flat 0.5)
+	glm::vec3 light_direction = glm::vec3(0.0f);
+	glm::vec3 light_energy = glm::vec3(2.0f);
+	if (light) {
+		light_direction = -glm::normalize(light->transform->make_world_from_local()[2]);
+		light_energy = light->energy;
+	}
+
+	glUseProgram(impostor_program->program);
+	glUniformMatrix4fv(impostor_program->CLIP_FROM_WORLD_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_world));
+	glUniform3fv(impostor_program->EYE_vec3, 1, glm::value_ptr(eye));
+	glUniform2fv(impostor_program->CENTER_vec2, 1, glm::value_ptr(center));
+	glUniform1f(impostor_program->RADIUS_float, radius);
+	glUniform2fv(impostor_program->HEIGHT_vec2, 1, glm::value_ptr(height));
+	glUniform1i(impostor_program->VIEWS_int, GLint(views));
+	glUniform3fv(impostor_program->LIGHT_DIRECTION_vec3, 1, glm::value_ptr(light_direction));
+	glUniform3fv(impostor_program->LIGHT_ENERGY_vec3, 1, glm::value_ptr(light_energy));
+	PerfStats::count_uniform_uploads(9);
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, color_texture);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, normal_texture);
+	glBindVertexArray(instance_vao);
+	PerfStats::count_state_changes(4); //(program, two textures, vertex array)
+
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, GLsizei(instances.size()));
+	PerfStats::count_draw(GL_TRIANGLES, uint32_t(6 * instances.size())); //(two triangles per instance)
+
+	glBindVertexArray(0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glUseProgram(0);
+	PerfStats::count_state_changes(4);
+
+	instances.clear();
+}
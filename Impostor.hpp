@@ -0,0 +1,77 @@
+#pragma once
+
+/*
+ * An Impostor stands in for a mesh that is far away: the mesh is pre-rendered
+ *  from several directions around its +z axis into an atlas, and distant
+ *  copies of it are drawn as camera-facing quads -- all of them in one
+ *  instanced draw call.
+ *
+ * //at global scope (baked once, after the meshes load):
+ * Load< Impostor > tree_impostor(LoadTagLate, []() -> Impostor const * {
+ *     return new Impostor(meshes->lookup("Tree"), meshes_vao);
+ * });
+ *
+ * //later:
+ * drawable.impostor = tree_impostor; //for each drawable showing "Tree"
+ *
+ * Scene::draw then switches each such drawable to its impostor when its
+ *  bounding box is less than Scene::impostor_pixels across (diagonally) on
+ *  screen, and draws all of the impostor's instances after the rest of the
+ *  scene.
+ *
+ * Each view's mip chain is built on its own (so views don't blur into their
+ *  neighbors) from premultiplied color and normals (so uncovered pixels
+ *  don't darken the silhouette as it shrinks).
+ *
+ * Impostors assume upright objects: only rotation about +z and uniform scale
+ *  (from world_from_object's first column) are kept. They are shaded only by the
+ *  scene's sky light (as a hemisphere light), not by clustered lights or shadows.
+ *
+ */
+
+#include "GL.hpp"
+#include "Mesh.hpp"
+#include "Scene.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+struct Impostor {
+	//bake 'mesh' from 'views' directions (each 'cell' x 'cell' pixels), drawing from 'vao':
+	// ('vao' must have Position, Normal, and Color at locations 0, 1, and 2 -- e.g., a vao made for LitColorTextureProgram)
+	// ('cell' must be a power of two)
+	Impostor(Mesh const &mesh, GLuint vao, uint32_t views = 8, uint32_t cell = 128);
+	~Impostor();
+	Impostor(Impostor const &) = delete;
+	Impostor &operator=(Impostor const &) = delete;
+
+	//queue a copy of the mesh as placed by 'world_from_object':
+	void add(glm::mat4x3 const &world_from_object) const;
+	//draw (and clear) the queued copies as seen from 'eye' through 'clip_from_world':
+	// ('light' -- if not null -- is a hemisphere light pointing along its -z axis; none == unlit)
+	void draw(glm::mat4 const &clip_from_world, glm::vec3 const &eye, Scene::Light const *light) const;
+
+	//-- internals ---
+	uint32_t views;
+	uint32_t cell;
+
+	//object-space area covered by each view:
+	glm::vec2 center; //(x, y)
+	float radius; //horizontal half-width
+	glm::vec2 height; //z range
+
+	GLuint color_texture = 0; //(views * cell) x cell; SRGB8_ALPHA8, premultiplied, mipmapped per view
+	GLuint normal_texture = 0; //same size; RGBA8, premultiplied, mipmapped per view
+
+	struct Instance {
+		glm::vec4 placement; //position (xyz), rotation about +z (w)
+		float scale;
+	};
+	static_assert(sizeof(Instance) == 4*4 + 4, "Instance is packed.");
+	mutable std::vector< Instance > instances; //queued by add()
+
+	GLuint instance_buffer = 0;
+	GLuint instance_vao = 0;
+};
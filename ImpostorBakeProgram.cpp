@@ -0,0 +1,49 @@
+#include "ImpostorBakeProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+
+Load< ImpostorBakeProgram > impostor_bake_program(LoadTagEarly);
+
+ImpostorBakeProgram::ImpostorBakeProgram() {
+	program = gl_compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform mat4 CLIP_FROM_OBJECT;\n"
+		"layout(location = 0) in vec4 Position;\n"
+		"layout(location = 1) in vec3 Normal;\n"
+		"layout(location = 2) in vec4 Color;\n"
+		"out vec3 normal;\n"
+		"out vec4 color;\n"
+		"void main() {\n"
+		"	gl_Position = CLIP_FROM_OBJECT * Position;\n"
+		"	normal = Normal;\n"
+		"	color = Color;\n"
+		"}\n"
+	,
+		//fragment shader:
+		// (alpha marks covered pixels; the runtime shader discards the rest)
+		"#version 330\n"
+		"in vec3 normal;\n"
+		"in vec4 color;\n"
+		"layout(location = 0) out vec4 outColor;\n"
+		"layout(location = 1) out vec4 outNormal;\n"
+		"void main() {\n"
+		"	outColor = vec4(color.rgb, 1.0);\n"
+		"	outNormal = vec4(normalize(normal) * 0.5 + 0.5, 1.0);\n"
+		"}\n"
+	);
+
+	//look up the locations of vertex attributes:
+	Position_vec4 = glGetAttribLocation(program, "Position");
+	Normal_vec3 = glGetAttribLocation(program, "Normal");
+	Color_vec4 = glGetAttribLocation(program, "Color");
+
+	//look up the locations of uniforms:
+	CLIP_FROM_OBJECT_mat4 = glGetUniformLocation(program, "CLIP_FROM_OBJECT");
+}
+
+ImpostorBakeProgram::~ImpostorBakeProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
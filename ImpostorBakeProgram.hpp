@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+
+//Shader program that Impostor uses to pre-render a mesh into its atlas:
+// writes vertex color to output 0 and the object-space normal (packed as n*0.5+0.5) to output 1
+// (attribute locations match LitColorTextureProgram, so the same vertex array objects work with both)
+struct ImpostorBakeProgram {
+	ImpostorBakeProgram();
+	~ImpostorBakeProgram();
+
+	GLuint program = 0;
+	//Attribute (per-vertex variable) locations:
+	GLuint Position_vec4 = -1U;
+	GLuint Normal_vec3 = -1U;
+	GLuint Color_vec4 = -1U;
+	//Uniform (per-invocation variable) locations:
+	GLuint CLIP_FROM_OBJECT_mat4 = -1U;
+	//Textures:
+	// none
+};
+
+extern Load< ImpostorBakeProgram > impostor_bake_program;
@@ -0,0 +1,89 @@
+#include "ImpostorProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+
+Load< ImpostorProgram > impostor_program(LoadTagEarly);
+
+ImpostorProgram::ImpostorProgram() {
+	program = gl_compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform mat4 CLIP_FROM_WORLD;\n"
+		"uniform vec3 EYE;\n"
+		"uniform vec2 CENTER;\n"
+		"uniform float RADIUS;\n"
+		"uniform vec2 HEIGHT;\n"
+		"uniform int VIEWS;\n"
+		"layout(location = 0) in vec4 Placement;\n"
+		"layout(location = 1) in float Scale;\n"
+		"out vec2 texCoord;\n"
+		"flat out vec2 turn;\n" //(cos, sin) of the instance's rotation, for normals
+		"void main() {\n"
+		"	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+		"	turn = vec2(cos(Placement.w), sin(Placement.w));\n"
+		"	vec2 center = Placement.xy + Scale * vec2(turn.x * CENTER.x - turn.y * CENTER.y, turn.y * CENTER.x + turn.x * CENTER.y);\n"
+		//turn about +z to face the eye:
+		"	vec2 to_eye = EYE.xy - center;\n"
+		"	if (dot(to_eye, to_eye) < 1e-8) to_eye = vec2(1.0, 0.0);\n"
+		"	to_eye = normalize(to_eye);\n"
+		"	vec2 right = vec2(-to_eye.y, to_eye.x);\n"
+		"	vec3 world = vec3(\n"
+		"		center + right * ((corner.x * 2.0 - 1.0) * RADIUS * Scale),\n"
+		"		Placement.z + Scale * mix(HEIGHT.x, HEIGHT.y, corner.y)\n"
+		"	);\n"
+		"	gl_Position = CLIP_FROM_WORLD * vec4(world, 1.0);\n"
+		//view i was baked from angle i * 2pi / VIEWS (in object space):
+		"	float angle = atan(to_eye.y, to_eye.x) - Placement.w;\n"
+		"	float view = mod(round(angle * float(VIEWS) / 6.28318530718), float(VIEWS));\n"
+		"	texCoord = vec2((view + corner.x) / float(VIEWS), corner.y);\n"
+		"}\n"
+	,
+		//fragment shader:
+		"#version 330\n"
+		"uniform sampler2D COLOR;\n"
+		"uniform sampler2D NORMAL;\n"
+		"uniform vec3 LIGHT_DIRECTION;\n"
+		"uniform vec3 LIGHT_ENERGY;\n"
+		"in vec2 texCoord;\n"
+		"flat in vec2 turn;\n"
+		"out vec4 fragColor;\n"
+		"void main() {\n"
+		//(both atlases are premultiplied, so un-premultiply what was sampled)
+		"	vec4 albedo = texture(COLOR, texCoord);\n"
+		"	if (albedo.a < 0.5) discard;\n"
+		"	vec4 encoded = texture(NORMAL, texCoord);\n"
+		"	vec3 o = encoded.xyz / max(encoded.a, 1e-3) * 2.0 - 1.0;\n"
+		"	vec3 n = normalize(vec3(turn.x * o.x - turn.y * o.y, turn.y * o.x + turn.x * o.y, o.z));\n"
+		"	vec3 e = (dot(n,-LIGHT_DIRECTION) * 0.5 + 0.5) * LIGHT_ENERGY;\n"
+		"	fragColor = vec4(e*albedo.rgb / albedo.a, 1.0);\n"
+		"}\n"
+	);
+
+	//look up the locations of vertex attributes:
+	Placement_vec4 = glGetAttribLocation(program, "Placement");
+	Scale_float = glGetAttribLocation(program, "Scale");
+
+	//look up the locations of uniforms:
+	CLIP_FROM_WORLD_mat4 = glGetUniformLocation(program, "CLIP_FROM_WORLD");
+	EYE_vec3 = glGetUniformLocation(program, "EYE");
+	CENTER_vec2 = glGetUniformLocation(program, "CENTER");
+	RADIUS_float = glGetUniformLocation(program, "RADIUS");
+	HEIGHT_vec2 = glGetUniformLocation(program, "HEIGHT");
+	VIEWS_int = glGetUniformLocation(program, "VIEWS");
+	LIGHT_DIRECTION_vec3 = glGetUniformLocation(program, "LIGHT_DIRECTION");
+	LIGHT_ENERGY_vec3 = glGetUniformLocation(program, "LIGHT_ENERGY");
+	GLuint COLOR_sampler2D = glGetUniformLocation(program, "COLOR");
+	GLuint NORMAL_sampler2D = glGetUniformLocation(program, "NORMAL");
+
+	//set COLOR and NORMAL to always refer to texture bindings zero and one:
+	glUseProgram(program);
+	glUniform1i(COLOR_sampler2D, 0);
+	glUniform1i(NORMAL_sampler2D, 1);
+	glUseProgram(0);
+}
+
+ImpostorProgram::~ImpostorProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+
+//Shader program that draws Impostor instances as camera-facing quads:
+// each instance is one triangle strip of four vertices (made from gl_VertexID), upright, turned to face
+// the eye, and textured with whichever of the atlas's views was baked from nearest that direction
+struct ImpostorProgram {
+	ImpostorProgram();
+	~ImpostorProgram();
+
+	GLuint program = 0;
+	//Attribute (per-instance variable) locations:
+	GLuint Placement_vec4 = -1U; //world position of the object's origin (xyz) and rotation about +z (w)
+	GLuint Scale_float = -1U; //uniform scale of the object
+	//Uniform (per-invocation variable) locations:
+	GLuint CLIP_FROM_WORLD_mat4 = -1U;
+	GLuint EYE_vec3 = -1U; //world-space eye position
+	GLuint CENTER_vec2 = -1U; //object-space center of the baked mesh (x, y)
+	GLuint RADIUS_float = -1U; //object-space half-width of each view
+	GLuint HEIGHT_vec2 = -1U; //object-space bottom and top of each view (z)
+	GLuint VIEWS_int = -1U; //number of views across the atlas
+	GLuint LIGHT_DIRECTION_vec3 = -1U; //hemisphere light (as in LitColorTextureProgram)
+	GLuint LIGHT_ENERGY_vec3 = -1U;
+	//Textures:
+	//TEXTURE0 - color atlas (premultiplied; alpha == coverage)
+	//TEXTURE1 - normal atlas (object space, packed as n*0.5+0.5, premultiplied)
+};
+
+extern Load< ImpostorProgram > impostor_program;
@@ -0,0 +1,57 @@
+#include "InstancedColorProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+
+Load< InstancedColorProgram > instanced_color_program(LoadTagEarly);
+
+InstancedColorProgram::InstancedColorProgram() {
+	//Compile vertex and fragment shaders using the convenient 'gl_compile_program' helper function:
+	program = gl_compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform mat4 CLIP_FROM_WORLD;\n"
+		"in vec4 Position;\n"
+		"in float End;\n"
+		"in vec4 WORLD_FROM_LOCAL_ROW0;\n"
+		"in vec4 WORLD_FROM_LOCAL_ROW1;\n"
+		"in vec4 WORLD_FROM_LOCAL_ROW2;\n"
+		"in vec4 Offset;\n"
+		"in vec4 Color;\n"
+		"out vec4 color;\n"
+		"void main() {\n"
+		"	vec3 world = vec3(\n"
+		"		dot(WORLD_FROM_LOCAL_ROW0, Position),\n"
+		"		dot(WORLD_FROM_LOCAL_ROW1, Position),\n"
+		"		dot(WORLD_FROM_LOCAL_ROW2, Position)\n"
+		"	) + End * Offset.xyz;\n"
+		"	gl_Position = CLIP_FROM_WORLD * vec4(world, 1.0);\n"
+		"	color = Color;\n"
+		"}\n"
+	,
+		//fragment shader:
+		"#version 330\n"
+		"in vec4 color;\n"
+		"out vec4 fragColor;\n"
+		"void main() {\n"
+		"	fragColor = color;\n"
+		"}\n"
+	);
+
+	//look up the locations of vertex attributes:
+	Position_vec4 = glGetAttribLocation(program, "Position");
+	End_float = glGetAttribLocation(program, "End");
+	WORLD_FROM_LOCAL_ROW0_vec4 = glGetAttribLocation(program, "WORLD_FROM_LOCAL_ROW0");
+	WORLD_FROM_LOCAL_ROW1_vec4 = glGetAttribLocation(program, "WORLD_FROM_LOCAL_ROW1");
+	WORLD_FROM_LOCAL_ROW2_vec4 = glGetAttribLocation(program, "WORLD_FROM_LOCAL_ROW2");
+	Offset_vec4 = glGetAttribLocation(program, "Offset");
+	Color_vec4 = glGetAttribLocation(program, "Color");
+
+	//look up the locations of uniforms:
+	CLIP_FROM_WORLD_mat4 = glGetUniformLocation(program, "CLIP_FROM_WORLD");
+}
+
+InstancedColorProgram::~InstancedColorProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+
+//Shader program that draws many copies ("instances") of a mesh, each with its own transform and color:
+// (used by DrawPrimitives)
+struct InstancedColorProgram {
+	InstancedColorProgram();
+	~InstancedColorProgram();
+
+	GLuint program = 0;
+	//Attribute (per-vertex variable) locations:
+	GLuint Position_vec4 = -1U;
+	GLuint End_float = -1U; //0 or 1: adds End * Offset (lets capsules stretch without distorting their caps)
+	//Attribute (per-instance variable) locations:
+	GLuint WORLD_FROM_LOCAL_ROW0_vec4 = -1U; //rows of the instance's 3x4 transform
+	GLuint WORLD_FROM_LOCAL_ROW1_vec4 = -1U;
+	GLuint WORLD_FROM_LOCAL_ROW2_vec4 = -1U;
+	GLuint Offset_vec4 = -1U;
+	GLuint Color_vec4 = -1U;
+	//Uniform (per-invocation variable) locations:
+	GLuint CLIP_FROM_WORLD_mat4 = -1U;
+	//Textures:
+	// none
+};
+
+extern Load< InstancedColorProgram > instanced_color_program;
@@ -2,75 +2,110 @@
 
 #include "gl_compile_program.hpp"
 #include "gl_errors.hpp"
+#include "PerfStats.hpp"
+
+#include <array>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
 
 Scene::Drawable::Pipeline lit_color_texture_program_pipeline;
 
+static GLuint white_texture = 0; //1-pixel, bound by default for textured variants
+
 Load< LitColorTextureProgram > lit_color_texture_program(LoadTagEarly, []() -> LitColorTextureProgram const * {
 	LitColorTextureProgram *ret = new LitColorTextureProgram();
 
-	//----- build the pipeline template -----
-	lit_color_texture_program_pipeline.program = ret->program;
-
-	lit_color_texture_program_pipeline.CLIP_FROM_OBJECT_mat4 = ret->CLIP_FROM_OBJECT_mat4;
-	lit_color_texture_program_pipeline.LIGHT_FROM_OBJECT_mat4x3 = ret->LIGHT_FROM_OBJECT_mat4x3;
-	lit_color_texture_program_pipeline.LIGHT_FROM_NORMAL_mat3 = ret->LIGHT_FROM_NORMAL_mat3;
-
-	/* This will be used later if/when we build a light loop into the Scene:
-	lit_color_texture_program_pipeline.LIGHT_TYPE_int = ret->LIGHT_TYPE_int;
-	lit_color_texture_program_pipeline.LIGHT_LOCATION_vec3 = ret->LIGHT_LOCATION_vec3;
-	lit_color_texture_program_pipeline.LIGHT_DIRECTION_vec3 = ret->LIGHT_DIRECTION_vec3;
-	lit_color_texture_program_pipeline.LIGHT_ENERGY_vec3 = ret->LIGHT_ENERGY_vec3;
-	lit_color_texture_program_pipeline.LIGHT_CUTOFF_float = ret->LIGHT_CUTOFF_float;
-	*/
-
 	//make a 1-pixel white texture to bind by default:
-	GLuint tex;
-	glGenTextures(1, &tex);
+	glGenTextures(1, &white_texture);
 
-	glBindTexture(GL_TEXTURE_2D, tex);
+	glBindTexture(GL_TEXTURE_2D, white_texture);
 	std::vector< glm::u8vec4 > tex_data(1, glm::u8vec4(0xff));
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, tex_data.data());
+	PerfStats::count_upload(tex_data.size() * sizeof(tex_data[0]));
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 	glBindTexture(GL_TEXTURE_2D, 0);
 
-
-	lit_color_texture_program_pipeline.textures[0].texture = tex;
-	lit_color_texture_program_pipeline.textures[0].target = GL_TEXTURE_2D;
+	//----- build the pipeline template -----
+	ret->set_pipeline(&lit_color_texture_program_pipeline);
 
 	return ret;
 });
 
-LitColorTextureProgram::LitColorTextureProgram() {
+LitColorTextureProgram const &LitColorTextureProgram::get(Variant const &variant) {
+	if (variant == Variant()) return *lit_color_texture_program;
+
+	//one slot per (light or clustered, textured, shadowed) combination:
+	static std::array< std::unique_ptr< LitColorTextureProgram >, 20 > variants;
+	uint32_t index = 0;
+	switch (variant.light) {
+		case Scene::Light::Point: index = 0; break;
+		case Scene::Light::Hemisphere: index = 1; break;
+		case Scene::Light::Spot: index = 2; break;
+		case Scene::Light::Directional: index = 3; break;
+		default: throw std::runtime_error("Unknown light type '" + std::string(1, char(variant.light)) + "'.");
+	}
+	if (variant.clustered) index = 4;
+	index = 2 * index + (variant.textured ? 1 : 0);
+	index = 2 * index + (variant.shadowed ? 1 : 0);
+	if (!variants[index]) variants[index] = std::make_unique< LitColorTextureProgram >(variant);
+	return *variants[index];
+}
+
+LitColorTextureProgram::LitColorTextureProgram() : LitColorTextureProgram(Variant()) {
+}
+
+LitColorTextureProgram::LitColorTextureProgram(Variant const &variant_) : variant(variant_) {
+	//specialization -- prepended to both shaders, and checked with #if:
+	std::string defines = "#version 330\n";
+	switch (variant.light) {
+		case Scene::Light::Point: defines += "#define LIGHT_TYPE 0\n"; break;
+		case Scene::Light::Hemisphere: defines += "#define LIGHT_TYPE 1\n"; break;
+		case Scene::Light::Spot: defines += "#define LIGHT_TYPE 2\n"; break;
+		case Scene::Light::Directional: defines += "#define LIGHT_TYPE 3\n"; break;
+		default: throw std::runtime_error("Unknown light type '" + std::string(1, char(variant.light)) + "'.");
+	}
+	defines += std::string("#define TEXTURED ") + (variant.textured ? "1" : "0") + "\n";
+	defines += std::string("#define CLUSTERED ") + (variant.clustered ? "1" : "0") + "\n";
+	defines += std::string("#define SHADOWED ") + (variant.shadowed ? "1" : "0") + "\n";
+
 	//Compile vertex and fragment shaders using the convenient 'gl_compile_program' helper function:
 	program = gl_compile_program(
 		//vertex shader:
-		"#version 330\n"
+		defines +
 		"uniform mat4 CLIP_FROM_OBJECT;\n"
 		"uniform mat4x3 LIGHT_FROM_OBJECT;\n" // generally multiply matrix x vector. Lets A_FROM_B * B line up well.
 		"uniform mat3 LIGHT_FROM_NORMAL;\n" // uniforms are all caps
-		"in vec4 Position;\n" // input attributes are title case
-		"in vec3 Normal;\n"
-		"in vec4 Color;\n"
-		"in vec2 TexCoord;\n"
+		"layout(location = 0) in vec4 Position;\n" // input attributes are title case
+		"layout(location = 1) in vec3 Normal;\n" // (locations are fixed so VAOs work with every variant)
+		"layout(location = 2) in vec4 Color;\n"
+		"layout(location = 3) in vec2 TexCoord;\n"
 		"out vec3 position;\n" // "out"s are eventually getting picked up
 		"out vec3 normal;\n" // outputs are lowercase
 		"out vec4 color;\n"
+		"#if TEXTURED\n"
 		"out vec2 texCoord;\n"
+		"#endif\n"
+		"invariant gl_Position;\n" // (bit-identical to DepthProgram's, so a depth prepass can be followed by GL_EQUAL)
 		"void main() {\n"
 		"	gl_Position = CLIP_FROM_OBJECT * Position;\n"
 		"	position = LIGHT_FROM_OBJECT * Position;\n" // Light Space: space we do lighting computation in
 		"	normal = LIGHT_FROM_NORMAL * Normal;\n" // gives lighting normal (gives direction, NOT position!)
 		"	color = Color;\n"
+		"#if TEXTURED\n"
 		"	texCoord = TexCoord;\n"
+		"#endif\n"
 		"}\n"
 	,
 		//fragment shader:
-		"#version 330\n"
+		defines +
+		"#if TEXTURED\n"
 		"uniform sampler2D TEX;\n"
-		"uniform int LIGHT_TYPE;\n"
+		"#endif\n"
 		"uniform vec3 LIGHT_LOCATION;\n"
 		"uniform vec3 LIGHT_DIRECTION;\n"
 		"uniform vec3 LIGHT_ENERGY;\n"
@@ -78,34 +113,99 @@ LitColorTextureProgram::LitColorTextureProgram() {
 		"in vec3 position;\n"
 		"in vec3 normal;\n"
 		"in vec4 color;\n"
+		"#if TEXTURED\n"
 		"in vec2 texCoord;\n"
+		"#endif\n"
 		"out vec4 fragColor;\n"
+		"#if CLUSTERED\n"
+		"uniform samplerBuffer LIGHTS;\n" // 3 texels per light: (position, type), (direction, cutoff), (energy, range)
+		"uniform usamplerBuffer CLUSTERS;\n" // per cluster: (first index, count)
+		"uniform usamplerBuffer LIGHT_INDICES;\n"
+		"uniform int GLOBAL_LIGHTS;\n" // lights [0, GLOBAL_LIGHTS) reach every cluster
+		"uniform vec4 CLUSTER_DEPTH_PLANE;\n"
+		"uniform vec2 CLUSTER_DEPTH_SCALE;\n"
+		"uniform vec2 CLUSTER_TILE_SIZE;\n"
+		"uniform ivec3 CLUSTER_COUNTS;\n"
+		"vec3 light_energy(int i, vec3 n) {\n" // same models as the single-light variants, below
+		"	vec4 a = texelFetch(LIGHTS, 3*i+0);\n"
+		"	vec4 b = texelFetch(LIGHTS, 3*i+1);\n"
+		"	vec4 c = texelFetch(LIGHTS, 3*i+2);\n"
+		"	int type = int(a.w);\n"
+		"	if (type == 1) return (dot(n,-b.xyz) * 0.5 + 0.5) * c.rgb;\n" // hemi
+		"	if (type == 3) return max(0.0, dot(n,-b.xyz)) * c.rgb;\n" // directional
+		"	vec3 l = (a.xyz - position);\n" // point or spot
+		"	float dis2 = dot(l,l);\n"
+		"	l = normalize(l);\n"
+		"	float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
+		"	float fade = clamp(1.0 - (dis2 * dis2) / (c.w * c.w * c.w * c.w), 0.0, 1.0);\n" // reach zero at the edge of the light's range
+		"	nl *= fade * fade;\n"
+		"	if (type == 2) nl *= smoothstep(b.w,mix(b.w,1.0,0.1), dot(l,-b.xyz));\n"
+		"	return nl * c.rgb;\n"
+		"}\n"
+		"#endif\n"
+		"#if SHADOWED\n"
+		"uniform sampler2DShadow SHADOW;\n"
+		"uniform mat4 SHADOW_FROM_LIGHT;\n"
+		"float sky_shadow(int type) {\n" // how much of a sky light of 'type' reaches this fragment
+		"	vec4 s = SHADOW_FROM_LIGHT * vec4(position, 1.0);\n"
+		"	vec2 texel = 1.0 / vec2(textureSize(SHADOW, 0));\n"
+		"	float lit = 0.25 * (\n" // four (bilinearly filtered) taps
+		"		texture(SHADOW, vec3(s.xy + vec2(-0.5,-0.5) * texel, s.z))\n"
+		"		+ texture(SHADOW, vec3(s.xy + vec2( 0.5,-0.5) * texel, s.z))\n"
+		"		+ texture(SHADOW, vec3(s.xy + vec2(-0.5, 0.5) * texel, s.z))\n"
+		"		+ texture(SHADOW, vec3(s.xy + vec2( 0.5, 0.5) * texel, s.z)));\n"
+		"	return (type == 1 ? mix(0.4, 1.0, lit) : lit);\n" // (hemisphere lights also come from the rest of the sky)
+		"}\n"
+		"#endif\n"
 		"float random(vec2 st) { //from https://thebookofshaders.com/10/\n"
 		"	return fract(sin(dot(st, vec2(12.9898, 78.233)))*43758.5453123);\n"
 		"}\n"
 		"void main() {\n"
 		"	vec3 n = normalize(normal);\n"
 		"	vec3 e;\n"
-		"	if (LIGHT_TYPE == 0) { //point light \n"
-		"		vec3 l = (LIGHT_LOCATION - position);\n"
-		"		float dis2 = dot(l,l);\n"
-		"		l = normalize(l);\n"
-		"		float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
-		"		e = nl * LIGHT_ENERGY;\n"
-		"	} else if (LIGHT_TYPE == 1) { //hemi light \n"
-		"		e = (dot(n,-LIGHT_DIRECTION) * 0.5 + 0.5) * LIGHT_ENERGY;\n"
-		"	} else if (LIGHT_TYPE == 2) { //spot light \n"
-		"		vec3 l = (LIGHT_LOCATION - position);\n"
-		"		float dis2 = dot(l,l);\n"
-		"		l = normalize(l);\n"
-		"		float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
-		"		float c = dot(l,-LIGHT_DIRECTION);\n"
-		"		nl *= smoothstep(LIGHT_CUTOFF,mix(LIGHT_CUTOFF,1.0,0.1), c);\n"
-		"		e = nl * LIGHT_ENERGY;\n"
-		"	} else { //(LIGHT_TYPE == 3) //directional light \n"
-		"		e = max(0.0, dot(n,-LIGHT_DIRECTION)) * LIGHT_ENERGY;\n"
+		"#if CLUSTERED\n"
+		"	e = vec3(0.0);\n"
+		"	for (int i = 0; i < GLOBAL_LIGHTS; ++i) {\n"
+		"		vec3 le = light_energy(i, n);\n"
+		"#if SHADOWED\n"
+		"		if (i == 0) le *= sky_shadow(int(texelFetch(LIGHTS, 0).w));\n"
+		"#endif\n"
+		"		e += le;\n"
+		"	}\n"
+		"	float depth = dot(CLUSTER_DEPTH_PLANE.xyz, position) + CLUSTER_DEPTH_PLANE.w;\n"
+		"	ivec3 cell = ivec3(ivec2(gl_FragCoord.xy / CLUSTER_TILE_SIZE), int(log(max(depth, 1e-6)) * CLUSTER_DEPTH_SCALE.x + CLUSTER_DEPTH_SCALE.y));\n"
+		"	cell = clamp(cell, ivec3(0), CLUSTER_COUNTS - 1);\n"
+		"	uvec2 cluster = texelFetch(CLUSTERS, (cell.z * CLUSTER_COUNTS.y + cell.y) * CLUSTER_COUNTS.x + cell.x).xy;\n"
+		"	for (uint i = 0u; i < cluster.y; ++i) {\n"
+		"		e += light_energy(int(texelFetch(LIGHT_INDICES, int(cluster.x + i)).r), n);\n"
 		"	}\n"
+		"#elif LIGHT_TYPE == 0 //point light \n"
+		"	vec3 l = (LIGHT_LOCATION - position);\n"
+		"	float dis2 = dot(l,l);\n"
+		"	l = normalize(l);\n"
+		"	float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
+		"	e = nl * LIGHT_ENERGY;\n"
+		"#elif LIGHT_TYPE == 1 //hemi light \n"
+		"	e = (dot(n,-LIGHT_DIRECTION) * 0.5 + 0.5) * LIGHT_ENERGY;\n"
+		"#elif LIGHT_TYPE == 2 //spot light \n"
+		"	vec3 l = (LIGHT_LOCATION - position);\n"
+		"	float dis2 = dot(l,l);\n"
+		"	l = normalize(l);\n"
+		"	float nl = max(0.0, dot(n, l)) / max(1.0, dis2);\n"
+		"	float c = dot(l,-LIGHT_DIRECTION);\n"
+		"	nl *= smoothstep(LIGHT_CUTOFF,mix(LIGHT_CUTOFF,1.0,0.1), c);\n"
+		"	e = nl * LIGHT_ENERGY;\n"
+		"#else //(LIGHT_TYPE == 3) //directional light \n"
+		"	e = max(0.0, dot(n,-LIGHT_DIRECTION)) * LIGHT_ENERGY;\n"
+		"#endif\n"
+		"#if SHADOWED && !CLUSTERED && (LIGHT_TYPE == 1 || LIGHT_TYPE == 3)\n"
+		"	e *= sky_shadow(LIGHT_TYPE);\n"
+		"#endif\n"
+		"#if TEXTURED\n"
 		"	vec4 albedo = texture(TEX, texCoord) * color;\n"
+		"#else\n"
+		"	vec4 albedo = color;\n"
+		"#endif\n"
 		"	fragColor = vec4(e*albedo.rgb, albedo.a);\n"
 		/* DEBUG: check color output linearity:
 		"	float t = random(gl_FragCoord.xy/1280.0);\n"
@@ -136,19 +236,38 @@ LitColorTextureProgram::LitColorTextureProgram() {
 	LIGHT_FROM_OBJECT_mat4x3 = glGetUniformLocation(program, "LIGHT_FROM_OBJECT");
 	LIGHT_FROM_NORMAL_mat3 = glGetUniformLocation(program, "LIGHT_FROM_NORMAL");
 
-	LIGHT_TYPE_int = glGetUniformLocation(program, "LIGHT_TYPE");
 	LIGHT_LOCATION_vec3 = glGetUniformLocation(program, "LIGHT_LOCATION");
 	LIGHT_DIRECTION_vec3 = glGetUniformLocation(program, "LIGHT_DIRECTION");
 	LIGHT_ENERGY_vec3 = glGetUniformLocation(program, "LIGHT_ENERGY");
 	LIGHT_CUTOFF_float = glGetUniformLocation(program, "LIGHT_CUTOFF");
 
+	GLOBAL_LIGHTS_int = glGetUniformLocation(program, "GLOBAL_LIGHTS");
+	CLUSTER_DEPTH_PLANE_vec4 = glGetUniformLocation(program, "CLUSTER_DEPTH_PLANE");
+	CLUSTER_DEPTH_SCALE_vec2 = glGetUniformLocation(program, "CLUSTER_DEPTH_SCALE");
+	CLUSTER_TILE_SIZE_vec2 = glGetUniformLocation(program, "CLUSTER_TILE_SIZE");
+	CLUSTER_COUNTS_ivec3 = glGetUniformLocation(program, "CLUSTER_COUNTS");
+
+	SHADOW_FROM_LIGHT_mat4 = glGetUniformLocation(program, "SHADOW_FROM_LIGHT");
+
 
 	GLuint TEX_sampler2D = glGetUniformLocation(program, "TEX");
 
-	//set TEX to always refer to texture binding zero:
+	GLuint LIGHTS_samplerBuffer = glGetUniformLocation(program, "LIGHTS");
+	GLuint CLUSTERS_usamplerBuffer = glGetUniformLocation(program, "CLUSTERS");
+	GLuint LIGHT_INDICES_usamplerBuffer = glGetUniformLocation(program, "LIGHT_INDICES");
+	GLuint SHADOW_sampler2DShadow = glGetUniformLocation(program, "SHADOW");
+
 	glUseProgram(program); //bind program -- glUniform* calls refer to this program now
 
-	glUniform1i(TEX_sampler2D, 0); //set TEX to sample from GL_TEXTURE0
+	//set TEX to always refer to texture binding zero:
+	if (TEX_sampler2D != -1U) glUniform1i(TEX_sampler2D, 0); //set TEX to sample from GL_TEXTURE0
+
+	//..and the light lists to bindings one through three:
+	if (LIGHTS_samplerBuffer != -1U) glUniform1i(LIGHTS_samplerBuffer, 1);
+	if (CLUSTERS_usamplerBuffer != -1U) glUniform1i(CLUSTERS_usamplerBuffer, 2);
+	if (LIGHT_INDICES_usamplerBuffer != -1U) glUniform1i(LIGHT_INDICES_usamplerBuffer, 3);
+	//..and the shadow map to binding four:
+	if (SHADOW_sampler2DShadow != -1U) glUniform1i(SHADOW_sampler2DShadow, 4);
 
 	glUseProgram(0); //unbind program -- glUniform* calls refer to ??? now
 }
@@ -158,3 +277,23 @@ LitColorTextureProgram::~LitColorTextureProgram() {
 	program = 0;
 }
 
+
+void LitColorTextureProgram::set_pipeline(Scene::Drawable::Pipeline *pipeline_) const {
+	assert(pipeline_);
+	auto &pipeline = *pipeline_;
+	pipeline.program = program;
+	pipeline.CLIP_FROM_OBJECT_mat4 = CLIP_FROM_OBJECT_mat4;
+	pipeline.LIGHT_FROM_OBJECT_mat4x3 = LIGHT_FROM_OBJECT_mat4x3;
+	pipeline.LIGHT_FROM_NORMAL_mat3 = LIGHT_FROM_NORMAL_mat3;
+
+	if (variant.textured) {
+		//make sure TEX has something to sample:
+		if (pipeline.textures[0].texture == 0) {
+			pipeline.textures[0].texture = white_texture;
+			pipeline.textures[0].target = GL_TEXTURE_2D;
+		}
+	} else if (pipeline.textures[0].texture == white_texture) {
+		//no need to bind the default texture if it won't be sampled:
+		pipeline.textures[0].texture = 0;
+	}
+}
@@ -4,14 +4,32 @@
 #include "Load.hpp"
 #include "Scene.hpp"
 
+#include <glm/glm.hpp>
+
 //Shader program that draws transformed, lit, textured vertices tinted with vertex colors:
 struct LitColorTextureProgram {
-	LitColorTextureProgram();
+	//the program is specialized (with #defines, so there's no per-fragment branching) for:
+	struct Variant {
+		Scene::Light::Type light = Scene::Light::Hemisphere; //the type of light
+		bool textured = true; //false: vertex colors only (TEX isn't sampled)
+		bool clustered = false; //true: every light in the ClusteredLights lists ('light' is ignored)
+		bool shadowed = false; //true: a ShadowMap shades the sky light (the single light if it is hemisphere or directional; else the first global light)
+		bool operator==(Variant const &) const = default;
+	};
+
+	LitColorTextureProgram(); //(default variant)
+	LitColorTextureProgram(Variant const &variant);
 	~LitColorTextureProgram();
 
+	//get a variant, compiling it on first use:
+	// (the default variant is 'lit_color_texture_program', below)
+	static LitColorTextureProgram const &get(Variant const &variant);
+
+	Variant variant;
 	GLuint program = 0;
 
 	//Attribute (per-vertex variable) locations:
+	// (fixed in the shader, so every variant can use the same vertex array objects)
 	GLuint Position_vec4 = -1U;
 	GLuint Normal_vec3 = -1U;
 	GLuint Color_vec4 = -1U;
@@ -22,15 +40,30 @@ struct LitColorTextureProgram {
 	GLuint LIGHT_FROM_OBJECT_mat4x3 = -1U;
 	GLuint LIGHT_FROM_NORMAL_mat3 = -1U;
 
-	//lighting:
-	GLuint LIGHT_TYPE_int = -1U;
+	//lighting (-1U if unused by this variant's light type):
 	GLuint LIGHT_LOCATION_vec3 = -1U;
 	GLuint LIGHT_DIRECTION_vec3 = -1U;
 	GLuint LIGHT_ENERGY_vec3 = -1U;
 	GLuint LIGHT_CUTOFF_float = -1U;
+
+	//clustered lighting (clustered variants only; see ClusteredLights):
+	GLuint GLOBAL_LIGHTS_int = -1U;
+	GLuint CLUSTER_DEPTH_PLANE_vec4 = -1U;
+	GLuint CLUSTER_DEPTH_SCALE_vec2 = -1U;
+	GLuint CLUSTER_TILE_SIZE_vec2 = -1U;
+	GLuint CLUSTER_COUNTS_ivec3 = -1U;
+
+	//shadows (shadowed variants only; see ShadowMap):
+	GLuint SHADOW_FROM_LIGHT_mat4 = -1U;
 	
 	//Textures:
-	//TEXTURE0 - texture that is accessed by TexCoord
+	//TEXTURE0 - texture that is accessed by TexCoord (textured variants only)
+	//TEXTURE1-3 - light, cluster, and index buffers (clustered variants only)
+	//TEXTURE4 - shadow map (shadowed variants only)
+
+	//point a pipeline at this variant (sets program and uniform locations; leaves vao, etc. alone):
+	// (also binds/unbinds the default white texture as needed, but leaves other textures alone)
+	void set_pipeline(Scene::Drawable::Pipeline *pipeline) const;
 };
 
 extern Load< LitColorTextureProgram > lit_color_texture_program;
@@ -1,5 +1,7 @@
 #include "Load.hpp"
 
+#include "Profiler.hpp"
+
 #include <array>
 #include <list>
 #include <cassert>
@@ -22,10 +24,15 @@ void call_load_functions() {
 	assert(!has_been_called && "call_load_functions should only be called *once*");
 	has_been_called = true;
 
+	PROFILE_ZONE("call_load_functions");
+
 	auto &load_lists = get_load_lists();
 	for (auto &fn_list : load_lists) {
 		while (!fn_list.empty()) {
-			(*fn_list.begin())(); //call first function in the list
+			{
+				PROFILE_ZONE("load function");
+				(*fn_list.begin())(); //call first function in the list
+			}
 			fn_list.pop_front(); //remove from list
 		}
 	}
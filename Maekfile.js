@@ -22,6 +22,12 @@ const maek = init_maek();
 
 const NEST_LIBS = `../nest-libs/${maek.OS}`;
 
+//set to true to count every OpenGL call (see GL-trace.hpp; F3 overlay and F9 report in the game):
+const GL_TRACE = false;
+if (GL_TRACE) {
+	maek.options.CPPFlags.push(maek.OS === "windows" ? `/DGL_TRACE` : `-DGL_TRACE`);
+}
+
 //set compile flags (these can also be overridden per-task using the "options" parameter):
 if (maek.OS === "windows") {
 	maek.options.CPPFlags.push(
@@ -118,23 +124,60 @@ if (maek.OS === 'windows') {
 const game_names = [
 	maek.CPP('PlayMode.cpp'),
 	maek.CPP('main.cpp'),
-	maek.CPP('LitColorTextureProgram.cpp')
+	maek.CPP('LitColorTextureProgram.cpp'),
+	maek.CPP('ClusteredLights.cpp'),
+	maek.CPP('ShadowMap.cpp'),
+	maek.CPP('OcclusionCuller.cpp'),
+	maek.CPP('DynamicResolution.cpp'),
+	maek.CPP('UpscaleProgram.cpp')
 	//, maek.CPP('ColorTextureProgram.cpp')  //not used right now, but you might want it
 ];
 
+//game simulation (no SDL or OpenGL; shared by the game and the headless sim):
+const world_names = [
+	maek.CPP('World.cpp')
+];
+
+const sim_names = [
+	maek.CPP('sim.cpp')
+];
+
+//zone timing (used by everything, including World, so linked into every executable):
+const profiler_names = [
+	maek.CPP('Profiler.cpp')
+];
+
+//PNG loading (shared by the common code and the offline texture packer):
+const png_names = [
+	maek.CPP('load_save_png.cpp')
+];
+
 const common_names = [
 	maek.CPP('data_path.cpp'),
 	maek.CPP('PathFont.cpp'),
 	maek.CPP('PathFont-font.cpp'),
 	maek.CPP('DrawLines.cpp'),
+	maek.CPP('DrawSDFText.cpp'),
+	maek.CPP('SDFTextProgram.cpp'),
 	maek.CPP('ColorProgram.cpp'),
+	maek.CPP('DrawPrimitives.cpp'),
+	maek.CPP('InstancedColorProgram.cpp'),
 	maek.CPP('Scene.cpp'),
+	maek.CPP('DepthProgram.cpp'),
+	maek.CPP('Impostor.cpp'),
+	maek.CPP('ImpostorProgram.cpp'),
+	maek.CPP('ImpostorBakeProgram.cpp'),
 	maek.CPP('Mesh.cpp'),
-	maek.CPP('load_save_png.cpp'),
+	...png_names,
 	maek.CPP('gl_compile_program.cpp'),
 	maek.CPP('Mode.cpp'),
 	maek.CPP('GL.cpp'),
-	maek.CPP('Load.cpp')
+	maek.CPP('GL-trace.cpp'),
+	maek.CPP('Load.cpp'),
+	maek.CPP('PerfStats.cpp'),
+	maek.CPP('GPUTimer.cpp'),
+	maek.CPP('Screenshot.cpp'),
+	maek.CPP('Texture.cpp')
 ];
 
 const show_mesh_names = [
@@ -153,12 +196,20 @@ const show_scene_names = [
 // objFiles: array of objects to link
 // exeFileBase: name of executable file to produce
 //returns exeFile: exeFileBase + a platform-dependant suffix (e.g., '.exe' on windows)
-const game_exe = maek.LINK([...game_names, ...common_names], 'dist/game');
-const show_meshes_exe = maek.LINK([...show_mesh_names, ...common_names], 'scenes/show-meshes');
-const show_scene_exe = maek.LINK([...show_scene_names, ...common_names], 'scenes/show-scene');
+const game_exe = maek.LINK([...game_names, ...world_names, ...common_names, ...profiler_names], 'dist/game');
+//the headless sim doesn't need a display or GPU, so it doesn't link SDL or OpenGL:
+const sim_exe = maek.LINK([...sim_names, ...world_names, ...profiler_names], 'dist/sim', {
+	LINKLibs: (maek.OS === 'windows' ? [] : [`-lm`, `-lpthread`])
+});
+const show_meshes_exe = maek.LINK([...show_mesh_names, ...common_names, ...profiler_names], 'scenes/show-meshes');
+const show_scene_exe = maek.LINK([...show_scene_names, ...common_names, ...profiler_names], 'scenes/show-scene');
+//offline texture atlas + mipmap packer (see Texture.hpp):
+const pack_textures_exe = maek.LINK([maek.CPP('pack-textures.cpp'), ...png_names, ...profiler_names], 'scenes/pack-textures');
+//offline level-of-detail generator for .pnct files (see Mesh.hpp):
+const lod_meshes_exe = maek.LINK([maek.CPP('lod-meshes.cpp')], 'scenes/lod-meshes');
 
 //set the default target to the game (and copy the readme files):
-maek.TARGETS = [game_exe, show_meshes_exe, show_scene_exe, ...copies];
+maek.TARGETS = [game_exe, sim_exe, show_meshes_exe, show_scene_exe, pack_textures_exe, lod_meshes_exe, ...copies];
 
 //Note that tasks that produce ':abstract targets' are never cached.
 // This is similar to how .PHONY targets behave in make.
@@ -1,5 +1,7 @@
 #include "Mesh.hpp"
 #include "read_write_chunk.hpp"
+#include "Profiler.hpp"
+#include "PerfStats.hpp"
 
 #include <glm/glm.hpp>
 
@@ -9,10 +11,12 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <list>
+#include <algorithm>
 #include <cstddef>
 
 MeshBuffer::MeshBuffer(std::string const &filename) {
-	glGenBuffers(1, &buffer);
+	PROFILE_ZONE("MeshBuffer load");
 
 	std::ifstream file(filename, std::ios::binary);
 
@@ -31,22 +35,21 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 	if (filename.size() >= 5 && filename.substr(filename.size()-5) == ".pnct") {
 		read_chunk(file, "pnct", &data);
 
-		//upload data (shove all the data from the file into a VBO)
+		//store attrib locations:
+		VertexArena::Format format;
+		format.stride = sizeof(Vertex);
+		format.Position = VertexArena::Attrib(3, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, Position));
+		format.Normal = VertexArena::Attrib(3, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, Normal));
+		format.Color = VertexArena::Attrib(4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), offsetof(Vertex, Color));
+		format.TexCoord = VertexArena::Attrib(2, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, TexCoord));
+
+		//upload data (shove all the data from the file into the end of the shared VBO)
 		//the GPU doesn't know how to access that data yet.
-		//bind number to GL_ARRAY_BUFFER, do something, unbind to the name
-		//like setting global variable, in a sense.
-		glBindBuffer(GL_ARRAY_BUFFER, buffer);
-		glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(Vertex), data.data(), GL_STATIC_DRAW);
-		glBindBuffer(GL_ARRAY_BUFFER, 0); // cleans up buffer so no one else accidentally writes to it
-		// fun fact, you can't use GL in a multi-threaded way!
+		arena = &VertexArena::get(format);
+		first = arena->append(data.data(), GLuint(data.size()));
 
 		total = GLuint(data.size()); //store total for later checks on index
-
-		//store attrib locations:
-		Position = Attrib(3, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, Position));
-		Normal = Attrib(3, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, Normal));
-		Color = Attrib(4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), offsetof(Vertex, Color));
-		TexCoord = Attrib(2, GL_FLOAT, GL_FALSE, sizeof(Vertex), offsetof(Vertex, TexCoord));
+		count = total;
 	} else {
 		throw std::runtime_error("Unknown file type '" + filename + "'");
 	}
@@ -64,6 +67,7 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 		std::vector< IndexEntry > index;
 		read_chunk(file, "idx0", &index);
 
+		std::vector< Mesh * > by_index(index.size(), nullptr); //(for the "lod0" chunk)
 		for (auto const &entry : index) {
 			if (!(entry.name_begin <= entry.name_end && entry.name_end <= strings.size())) {
 				throw std::runtime_error("index entry has out-of-range name begin/end");
@@ -74,15 +78,45 @@ MeshBuffer::MeshBuffer(std::string const &filename) {
 			std::string name(&strings[0] + entry.name_begin, &strings[0] + entry.name_end);
 			Mesh mesh;
 			mesh.type = GL_TRIANGLES;
-			mesh.start = entry.vertex_begin;
+			mesh.start = first + entry.vertex_begin;
 			mesh.count = entry.vertex_end - entry.vertex_begin;
 			for (uint32_t v = entry.vertex_begin; v < entry.vertex_end; ++v) {
 				mesh.min = glm::min(mesh.min, data[v].Position);
 				mesh.max = glm::max(mesh.max, data[v].Position);
 			}
-			bool inserted = meshes.insert(std::make_pair(name, mesh)).second;
+			auto [at, inserted] = meshes.insert(std::make_pair(name, mesh));
 			if (!inserted) {
 				std::cerr << "WARNING: mesh name '" + name + "' in filename '" + filename + "' collides with existing mesh." << std::endl;
+			} else {
+				by_index[&entry - &index[0]] = &at->second;
+			}
+		}
+
+		//levels of detail (optional; see lod-meshes.cpp):
+		if (file.peek() != EOF) {
+			struct LODEntry {
+				uint32_t mesh; //index in "idx0"
+				uint32_t vertex_begin, vertex_end;
+				float error;
+			};
+			static_assert(sizeof(LODEntry) == 16, "LOD entry should be packed");
+
+			std::vector< LODEntry > lods;
+			read_chunk(file, "lod0", &lods);
+
+			for (auto const &entry : lods) {
+				if (!(entry.mesh < index.size())) {
+					throw std::runtime_error("lod entry has out-of-range mesh index");
+				}
+				if (!(entry.vertex_begin <= entry.vertex_end && entry.vertex_end <= total)) {
+					throw std::runtime_error("lod entry has out-of-range vertex start/count");
+				}
+				if (!by_index[entry.mesh]) continue; //(name collided, so the mesh was dropped)
+				Mesh::LOD lod;
+				lod.start = first + entry.vertex_begin;
+				lod.count = entry.vertex_end - entry.vertex_begin;
+				lod.error = entry.error;
+				by_index[entry.mesh]->lods.emplace_back(lod);
 			}
 		}
 	}
@@ -111,35 +145,92 @@ const Mesh &MeshBuffer::lookup(std::string const &name) const {
 }
 
 GLuint MeshBuffer::make_vao_for_program(GLuint program) const {
+	return arena->vao_for_program(program);
+}
 
-	//create a new vertex array object:
-	GLuint vao = 0;
-	glGenVertexArrays(1, &vao); // makes a fresh name
-	glBindVertexArray(vao); // binds the vertex array
+//-------------------------
 
-	//Try to bind all attributes in this buffer:
-	std::set< GLuint > bound;
+VertexArena &VertexArena::get(Format const &format) {
+	//(a list, so references stay valid as arenas are added)
+	static std::list< VertexArena > arenas;
+	for (VertexArena &arena : arenas) {
+		if (arena.format == format) return arena;
+	}
+	return arenas.emplace_back(format);
+}
+
+VertexArena::VertexArena(Format const &format_) : format(format_) {
+	glGenBuffers(1, &buffer);
+}
+
+GLuint VertexArena::append(void const *data, GLuint count) {
+	GLuint at = used;
+	if (count == 0) return at;
+
+	if (used + count > capacity) {
+		//grow (at least doubling, so loading many files doesn't copy much), keeping what's already there:
+		GLuint new_capacity = std::max(std::max(2 * capacity, used + count), GLuint(1 << 16));
+		GLuint new_buffer = 0;
+		glGenBuffers(1, &new_buffer);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, new_buffer);
+		glBufferData(GL_COPY_WRITE_BUFFER, GLsizeiptr(new_capacity) * format.stride, nullptr, GL_STATIC_DRAW);
+		if (used > 0) {
+			glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, GLsizeiptr(used) * format.stride);
+			glBindBuffer(GL_COPY_READ_BUFFER, 0);
+		}
+		glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+		glDeleteBuffers(1, &buffer);
+		buffer = new_buffer;
+		capacity = new_capacity;
+
+		//the vaos handed out so far now need to read from the new buffer:
+		for (auto const &[layout, vao] : vaos) {
+			glBindVertexArray(vao);
+			set_attributes(layout);
+		}
+		glBindVertexArray(0);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferSubData(GL_ARRAY_BUFFER, GLintptr(at) * format.stride, GLsizeiptr(count) * format.stride, data);
+	PerfStats::count_upload(size_t(count) * format.stride);
+	glBindBuffer(GL_ARRAY_BUFFER, 0); // cleans up buffer so no one else accidentally writes to it
+	// fun fact, you can't use GL in a multi-threaded way!
+
+	used += count;
+	return at;
+}
+
+void VertexArena::set_attributes(Layout const &layout) const {
 	glBindBuffer(GL_ARRAY_BUFFER, buffer);
-	auto bind_attribute = [&](char const *name, MeshBuffer::Attrib const &attrib) {
-		if (attrib.size == 0) return; //don't bind empty attribs
-		GLint location = glGetAttribLocation(program, name); // give me the index! the driver could choose any index at compile time
-		if (location == -1) return; //can't bind missing attribs
+	Attrib const *attribs[4] = {&format.Position, &format.Normal, &format.Color, &format.TexCoord};
+	for (uint32_t i = 0; i < 4; ++i) {
+		if (layout[i] == -1) continue;
+		Attrib const &attrib = *attribs[i];
 		// fun fact: constructing a pointer that refers to nothing is undefined behavior!
 		// Any compiler that compiles this can do whatever it wants, but in practice it will always point to 5. Old machines would panic
 		// at the invalid pointer, but modern ones are fine.
-		glVertexAttribPointer(location, attrib.size, attrib.type, attrib.normalized, attrib.stride, (GLbyte *)0 + attrib.offset);
-		glEnableVertexAttribArray(location);
-		bound.insert(location);
-	};
-	// binds attributes to attribute information object stored
-	bind_attribute("Position", Position);
-	bind_attribute("Normal", Normal);
-	bind_attribute("Color", Color);
-	bind_attribute("TexCoord", TexCoord);
+		glVertexAttribPointer(layout[i], attrib.size, attrib.type, attrib.normalized, attrib.stride, (GLbyte *)0 + attrib.offset);
+		glEnableVertexAttribArray(layout[i]);
+	}
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
+}
+
+GLuint VertexArena::vao_for_program(GLuint program) {
+	//Where does the program want each attribute this format has?
+	Layout layout;
+	std::set< GLuint > bound;
+	char const *names[4] = {"Position", "Normal", "Color", "TexCoord"};
+	Attrib const *attribs[4] = {&format.Position, &format.Normal, &format.Color, &format.TexCoord};
+	for (uint32_t i = 0; i < 4; ++i) {
+		layout[i] = -1;
+		if (attribs[i]->size == 0) continue; //don't bind empty attribs
+		layout[i] = glGetAttribLocation(program, names[i]); // give me the index! the driver could choose any index at compile time
+		if (layout[i] != -1) bound.insert(GLuint(layout[i])); //(can't bind missing attribs)
+	}
 
-	//Check that all active attributes were bound:
+	//Check that all active attributes will be bound:
 	GLint active = 0;
 	glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &active);
 	assert(active >= 0 && "Doesn't makes sense to have negative active attributes.");
@@ -155,5 +246,17 @@ GLuint MeshBuffer::make_vao_for_program(GLuint program) const {
 		}
 	}
 
+	//programs that agree on locations share a vertex array object:
+	auto f = vaos.find(layout);
+	if (f != vaos.end()) return f->second;
+
+	//create a new vertex array object:
+	GLuint vao = 0;
+	glGenVertexArrays(1, &vao); // makes a fresh name
+	glBindVertexArray(vao); // binds the vertex array
+	set_attributes(layout);
+	glBindVertexArray(0);
+
+	vaos.emplace(layout, vao);
 	return vao;
 }
@@ -3,21 +3,32 @@
 /*
  * In this code, "Mesh" is a range of vertices that should be sent through
  *  the OpenGL pipeline together.
- * A "MeshBuffer" holds a collection of such meshes (loaded from a file) in
- *  a single OpenGL array buffer. Individual meshes can be looked up by name
- *  using the MeshBuffer::lookup() function.
+ * A "MeshBuffer" holds a collection of such meshes (loaded from a file).
+ *  Individual meshes can be looked up by name using the MeshBuffer::lookup()
+ *  function.
+ *
+ * MeshBuffers don't have OpenGL buffers of their own: the vertices of every
+ *  MeshBuffer with the same vertex format go into one shared "VertexArena",
+ *  and Mesh::start counts from the start of the arena. So meshes from
+ *  different files can be drawn with the same vertex array object, without
+ *  rebinding in between (and in the same batched or multi-draw call).
+ *
+ * Files run through lod-meshes also hold coarser versions of each mesh
+ *  (Mesh::lods), which Scene::draw swaps in when a drawable is small on screen.
  *
  */
 
 #include "GL.hpp"
 #include <glm/glm.hpp>
+#include <array>
 #include <map>
 #include <limits>
 #include <string>
+#include <vector>
 
 
 struct Mesh {
-	//Meshes are vertex ranges (and primitive types) in their MeshBuffer:
+	//Meshes are vertex ranges (and primitive types) in their MeshBuffer's VertexArena:
 
 	GLenum type = GL_TRIANGLES; //type of primitives in mesh
 	GLuint start = 0; //index of first vertex
@@ -27,6 +38,70 @@ struct Mesh {
 	//useful for debug visualization and (perhaps, eventually) collision detection:
 	glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
 	glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+
+	//Levels of detail (coarser versions of the mesh, finest first; empty if the file has none):
+	struct LOD {
+		GLuint start = 0; //index of first vertex
+		GLuint count = 0; //count of vertices
+		float error = 0.0f; //farthest any vertex moved from the full mesh
+	};
+	std::vector< LOD > lods;
+};
+
+//One OpenGL array buffer holding the vertices of every MeshBuffer in one vertex format:
+struct VertexArena {
+	//These 'Attrib' structures describe the location of various attributes within each vertex (in exactly format wanted by glVertexAttribPointer):
+	struct Attrib {
+		GLint size = 0;
+		GLenum type = 0;
+		GLboolean normalized = GL_FALSE;
+		GLsizei stride = 0;
+		GLsizei offset = 0;
+
+		Attrib() = default;
+		Attrib(GLint size_, GLenum type_, GLboolean normalized_, GLsizei stride_, GLsizei offset_)
+		: size(size_), type(type_), normalized(normalized_), stride(stride_), offset(offset_) { }
+		bool operator==(Attrib const &) const = default;
+	};
+
+	struct Format {
+		GLsizei stride = 0; //bytes per vertex
+		Attrib Position;
+		Attrib Normal;
+		Attrib Color;
+		Attrib TexCoord;
+		bool operator==(Format const &) const = default;
+	};
+
+	//the arena for vertices in 'format' (made on first use; arenas are never freed):
+	static VertexArena &get(Format const &format);
+
+	Format format;
+
+	//This is the OpenGL vertex buffer object containing the vertices:
+	// (it is replaced by a bigger one when full, so don't hold on to it)
+	GLuint buffer = 0;
+	GLuint capacity = 0; //vertices 'buffer' has room for
+	GLuint used = 0; //vertices appended so far
+
+	//copy 'count' vertices (each format.stride bytes) into the arena, returning the index of the first:
+	GLuint append(void const *data, GLuint count);
+
+	//the vertex array object that links this arena's buffer to a program's attributes:
+	// note: will throw if program defines attributes not contained in this format
+	// note: shared by all programs that put the same attributes at the same locations (so don't delete it)
+	GLuint vao_for_program(GLuint program);
+
+	//-- internals ---
+
+	explicit VertexArena(Format const &format);
+	VertexArena(VertexArena const &) = delete;
+
+	//vertex array objects, by the locations of Position, Normal, Color, and TexCoord (-1 == not used):
+	using Layout = std::array< GLint, 4 >;
+	std::map< Layout, GLuint > vaos;
+	//point the currently-bound vertex array object's attributes at 'buffer':
+	void set_attributes(Layout const &layout) const;
 };
 
 struct MeshBuffer {
@@ -38,33 +113,18 @@ struct MeshBuffer {
 	// note: will throw if mesh not found.
 	const Mesh &lookup(std::string const &name) const;
 	
-	//build a vertex array object that links this vbo to attributes to a program:
+	//get the vertex array object that links the arena's vbo to attributes to a program:
 	// note: will throw if program defines attributes not contained in this buffer
+	// note: the vao is shared with every other MeshBuffer in the same arena (see VertexArena::vao_for_program)
 	GLuint make_vao_for_program(GLuint program) const; // pass handle to GLO program
 
-	//This is the OpenGL vertex buffer object containing the mesh data:
-	GLuint buffer = 0;
+	//The arena holding the mesh data (this file's vertices are [first, first + count) in arena->buffer):
+	VertexArena *arena = nullptr;
+	GLuint first = 0;
+	GLuint count = 0;
 
 	//-- internals ---
 
 	//used by the lookup() function:
 	std::map< std::string, Mesh > meshes;
-
-	//These 'Attrib' structures describe the location of various attributes within the buffer (in exactly format wanted by glVertexAttribPointer). They are set when the file is loaded and are used by the "make_vao_for_program" call:
-	struct Attrib {
-		GLint size = 0;
-		GLenum type = 0;
-		GLboolean normalized = GL_FALSE;
-		GLsizei stride = 0;
-		GLsizei offset = 0;
-
-		Attrib() = default;
-		Attrib(GLint size_, GLenum type_, GLboolean normalized_, GLsizei stride_, GLsizei offset_)
-		: size(size_), type(type_), normalized(normalized_), stride(stride_), offset(offset_) { }
-	};
-
-	Attrib Position;
-	Attrib Normal;
-	Attrib Color;
-	Attrib TexCoord;
 };
@@ -0,0 +1,375 @@
+#include "OcclusionCuller.hpp"
+
+#include "Profiler.hpp"
+#include "PerfStats.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OCCLUSION_SSE2
+#endif
+
+//points closer than this (in view depth) are too near the eye to project sensibly:
+static constexpr float NearW = 0.05f;
+
+//------ workers ------
+
+//persistent threads that split up a job (indices [0,count)) with the calling thread:
+struct OcclusionCuller::Workers {
+	Workers(uint32_t count) {
+		for (uint32_t t = 0; t < count; ++t) {
+			threads.emplace_back([this,t](){ work(t); });
+		}
+	}
+	~Workers() {
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			quit = true;
+		}
+		start_cv.notify_all();
+		for (auto &thread : threads) {
+			thread.join();
+		}
+	}
+
+	void run(uint32_t count, std::function< void(uint32_t) > const &fn) {
+		if (threads.empty() || count <= 1) {
+			for (uint32_t i = 0; i < count; ++i) fn(i);
+			return;
+		}
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			job = &fn;
+			job_count = count;
+			next = 0;
+			busy = uint32_t(threads.size());
+			++generation;
+		}
+		start_cv.notify_all();
+
+		//the calling thread works too:
+		for (uint32_t i = next++; i < count; i = next++) fn(i);
+
+		std::unique_lock< std::mutex > lock(mutex);
+		done_cv.wait(lock, [this](){ return busy == 0; });
+		job = nullptr;
+	}
+
+	void work(uint32_t index) {
+		if (Profiler::enabled) Profiler::set_thread_name("occlusion " + std::to_string(index));
+		uint64_t seen = 0;
+		std::unique_lock< std::mutex > lock(mutex);
+		while (true) {
+			start_cv.wait(lock, [&](){ return quit || generation != seen; });
+			if (quit) break;
+			seen = generation;
+			std::function< void(uint32_t) > const &fn = *job;
+			uint32_t count = job_count;
+			lock.unlock();
+
+			for (uint32_t i = next++; i < count; i = next++) fn(i);
+
+			lock.lock();
+			if (--busy == 0) done_cv.notify_one();
+		}
+	}
+
+	std::vector< std::thread > threads;
+	std::mutex mutex;
+	std::condition_variable start_cv, done_cv;
+	std::function< void(uint32_t) > const *job = nullptr;
+	uint32_t job_count = 0;
+	std::atomic< uint32_t > next{0};
+	uint32_t busy = 0; //threads still working on this generation's job
+	uint64_t generation = 0;
+	bool quit = false;
+};
+
+//------ OcclusionCuller ------
+
+OcclusionCuller::OcclusionCuller(uint32_t threads) {
+	if (threads == -1U) {
+		//(one per band at most; leave a core for the rest of the game)
+		uint32_t cores = std::thread::hardware_concurrency();
+		threads = std::min(Height / Band - 1, (cores > 2 ? cores - 2 : 0));
+	}
+	workers = std::make_unique< Workers >(threads);
+
+	depth.assign(Width * Height, 0.0f);
+	tiles.assign((Width / Tile) * (Height / Tile), 0.0f);
+}
+
+OcclusionCuller::~OcclusionCuller() {
+}
+
+//the twelve triangles of a box, as corner indices (bit 0: max.x, bit 1: max.y, bit 2: max.z), counterclockwise from outside:
+static std::array< std::array< uint8_t, 3 >, 12 > const &box_triangles() {
+	static std::array< std::array< uint8_t, 3 >, 12 > const triangles = [](){
+		std::array< std::array< uint8_t, 3 >, 12 > ret;
+		auto corner = [](uint32_t i) {
+			return glm::ivec3(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+		};
+		uint32_t t = 0;
+		for (uint32_t axis = 0; axis < 3; ++axis) {
+			for (uint32_t side = 0; side < 2; ++side) {
+				//walk around the face's four corners:
+				uint32_t u = 1 << ((axis + 1) % 3);
+				uint32_t v = 1 << ((axis + 2) % 3);
+				uint32_t base = side << axis;
+				std::array< uint8_t, 4 > quad{ uint8_t(base), uint8_t(base | u), uint8_t(base | u | v), uint8_t(base | v) };
+				//...in the direction that faces out:
+				glm::ivec3 normal = glm::cross(corner(quad[1]) - corner(quad[0]), corner(quad[2]) - corner(quad[0]));
+				if ((normal[axis] > 0) != (side == 1)) std::swap(quad[1], quad[3]);
+				ret[t++] = { quad[0], quad[1], quad[2] };
+				ret[t++] = { quad[0], quad[2], quad[3] };
+			}
+		}
+		return ret;
+	}();
+	return triangles;
+}
+
+//draw 'triangle' into rows [y0, y1) of 'depth', keeping the nearest (largest) 1/w:
+static void rasterize(OcclusionCuller::Triangle const &tri, uint32_t y0, uint32_t y1, float *depth) {
+	constexpr uint32_t W = OcclusionCuller::Width;
+
+	//bounds (in pixel centers), clipped to the buffer and band:
+	float min_x = std::min(tri.a.x, std::min(tri.b.x, tri.c.x));
+	float max_x = std::max(tri.a.x, std::max(tri.b.x, tri.c.x));
+	float min_y = std::min(tri.a.y, std::min(tri.b.y, tri.c.y));
+	float max_y = std::max(tri.a.y, std::max(tri.b.y, tri.c.y));
+	int32_t x_begin = std::max(0, int32_t(std::floor(min_x - 0.5f)));
+	int32_t x_end = std::min(int32_t(W), int32_t(std::ceil(max_x - 0.5f)) + 1);
+	int32_t y_begin = std::max(int32_t(y0), int32_t(std::floor(min_y - 0.5f)));
+	int32_t y_end = std::min(int32_t(y1), int32_t(std::ceil(max_y - 0.5f)) + 1);
+	if (x_begin >= x_end || y_begin >= y_end) return;
+	x_begin &= ~3; //(whole groups of four)
+
+	//edge functions, e(x,y) = A x + B y + C, positive inside (triangles are counterclockwise):
+	auto edge = [](glm::vec3 const &p, glm::vec3 const &q) {
+		float A = -(q.y - p.y);
+		float B = (q.x - p.x);
+		return glm::vec3(A, B, -(A * p.x + B * p.y));
+	};
+	glm::vec3 e0 = edge(tri.b, tri.c);
+	glm::vec3 e1 = edge(tri.c, tri.a);
+	glm::vec3 e2 = edge(tri.a, tri.b);
+
+	//depth plane, z(x,y) = A x + B y + C, from barycentric weights:
+	float area = e2.x * tri.c.x + e2.y * tri.c.y + e2.z;
+	glm::vec3 z = (e0 * tri.a.z + e1 * tri.b.z + e2 * tri.c.z) / area;
+
+#ifdef OCCLUSION_SSE2
+	__m128 const offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	__m128 const zero = _mm_setzero_ps();
+	__m128 const e0_x = _mm_set1_ps(e0.x), e1_x = _mm_set1_ps(e1.x), e2_x = _mm_set1_ps(e2.x), z_x = _mm_set1_ps(z.x);
+	for (int32_t y = y_begin; y < y_end; ++y) {
+		float py = float(y) + 0.5f;
+		__m128 e0_row = _mm_set1_ps(e0.y * py + e0.z);
+		__m128 e1_row = _mm_set1_ps(e1.y * py + e1.z);
+		__m128 e2_row = _mm_set1_ps(e2.y * py + e2.z);
+		__m128 z_row = _mm_set1_ps(z.y * py + z.z);
+		float *row = depth + y * W;
+		for (int32_t x = x_begin; x < x_end; x += 4) {
+			__m128 px = _mm_add_ps(_mm_set1_ps(float(x)), offsets);
+			__m128 inside = _mm_and_ps(
+				_mm_and_ps(
+					_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e0_x, px), e0_row), zero),
+					_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e1_x, px), e1_row), zero)),
+				_mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e2_x, px), e2_row), zero));
+			if (_mm_movemask_ps(inside) == 0) continue;
+			__m128 old_z = _mm_loadu_ps(row + x);
+			__m128 new_z = _mm_max_ps(old_z, _mm_add_ps(_mm_mul_ps(z_x, px), z_row));
+			_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, new_z), _mm_andnot_ps(inside, old_z)));
+		}
+	}
+#else
+	for (int32_t y = y_begin; y < y_end; ++y) {
+		float py = float(y) + 0.5f;
+		float *row = depth + y * W;
+		for (int32_t x = x_begin; x < x_end; ++x) {
+			float px = float(x) + 0.5f;
+			if (e0.x * px + e0.y * py + e0.z < 0.0f) continue;
+			if (e1.x * px + e1.y * py + e1.z < 0.0f) continue;
+			if (e2.x * px + e2.y * py + e2.z < 0.0f) continue;
+			row[x] = std::max(row[x], z.x * px + z.y * py + z.z);
+		}
+	}
+#endif
+}
+
+void OcclusionCuller::render(glm::mat4 const &clip_from_world) {
+	PROFILE_ZONE("OcclusionCuller::render");
+
+	//set up front-facing triangles in pixel coordinates:
+	triangles.clear();
+	auto const &box = box_triangles();
+	for (Box const &occluder : occluders) {
+		std::array< glm::vec3, 8 > corners;
+		std::array< bool, 8 > in_front;
+		for (uint32_t i = 0; i < 8; ++i) {
+			glm::vec4 clip = clip_from_world * glm::vec4(
+				(i & 1 ? occluder.max.x : occluder.min.x),
+				(i & 2 ? occluder.max.y : occluder.min.y),
+				(i & 4 ? occluder.max.z : occluder.min.z),
+				1.0f);
+			in_front[i] = (clip.w > NearW);
+			float inv_w = 1.0f / clip.w;
+			corners[i] = glm::vec3(
+				(clip.x * inv_w * 0.5f + 0.5f) * float(Width),
+				(clip.y * inv_w * 0.5f + 0.5f) * float(Height),
+				inv_w);
+		}
+		for (auto const &t : box) {
+			//(triangles reaching behind the eye are dropped, which only makes the occluder smaller)
+			if (!in_front[t[0]] || !in_front[t[1]] || !in_front[t[2]]) continue;
+			Triangle tri{corners[t[0]], corners[t[1]], corners[t[2]]};
+			float area = (tri.b.x - tri.a.x) * (tri.c.y - tri.a.y) - (tri.c.x - tri.a.x) * (tri.b.y - tri.a.y);
+			if (area <= 0.0f) continue; //back face (or edge-on)
+			triangles.emplace_back(tri);
+		}
+	}
+
+	//each band clears, rasterizes, and summarizes its own rows:
+	std::function< void(uint32_t) > band = [this](uint32_t index) {
+		uint32_t y0 = index * Band;
+		uint32_t y1 = y0 + Band;
+		std::fill(depth.begin() + y0 * Width, depth.begin() + y1 * Width, 0.0f);
+		for (Triangle const &tri : triangles) {
+			rasterize(tri, y0, y1, depth.data());
+		}
+
+		//farthest depth in each tile:
+		constexpr uint32_t TilesX = Width / Tile;
+		for (uint32_t ty = y0 / Tile; ty < y1 / Tile; ++ty) {
+			for (uint32_t tx = 0; tx < TilesX; ++tx) {
+				float const *at = depth.data() + (ty * Tile) * Width + tx * Tile;
+#ifdef OCCLUSION_SSE2
+				__m128 farthest = _mm_loadu_ps(at);
+				for (uint32_t y = 0; y < Tile; ++y) {
+					for (uint32_t x = 0; x < Tile; x += 4) {
+						farthest = _mm_min_ps(farthest, _mm_loadu_ps(at + y * Width + x));
+					}
+				}
+				farthest = _mm_min_ps(farthest, _mm_shuffle_ps(farthest, farthest, _MM_SHUFFLE(1, 0, 3, 2)));
+				farthest = _mm_min_ps(farthest, _mm_shuffle_ps(farthest, farthest, _MM_SHUFFLE(2, 3, 0, 1)));
+				tiles[ty * TilesX + tx] = _mm_cvtss_f32(farthest);
+#else
+				float farthest = at[0];
+				for (uint32_t y = 0; y < Tile; ++y) {
+					for (uint32_t x = 0; x < Tile; ++x) {
+						farthest = std::min(farthest, at[y * Width + x]);
+					}
+				}
+				tiles[ty * TilesX + tx] = farthest;
+#endif
+			}
+		}
+	};
+	workers->run(Height / Band, band);
+}
+
+bool OcclusionCuller::visible(glm::mat4 const &clip_from_object, glm::vec3 const &min, glm::vec3 const &max) const {
+	//project the corners:
+	glm::vec2 lo = glm::vec2( std::numeric_limits< float >::infinity());
+	glm::vec2 hi = glm::vec2(-std::numeric_limits< float >::infinity());
+	float nearest = 0.0f; //largest 1/w
+	uint32_t outside_left = 0, outside_right = 0, outside_below = 0, outside_above = 0;
+	bool behind = false;
+	for (uint32_t i = 0; i < 8; ++i) {
+		glm::vec4 clip = clip_from_object * glm::vec4(
+			(i & 1 ? max.x : min.x),
+			(i & 2 ? max.y : min.y),
+			(i & 4 ? max.z : min.z),
+			1.0f);
+		outside_left += (clip.x < -clip.w);
+		outside_right += (clip.x > clip.w);
+		outside_below += (clip.y < -clip.w);
+		outside_above += (clip.y > clip.w);
+		if (clip.w <= NearW) {
+			behind = true;
+			continue;
+		}
+		float inv_w = 1.0f / clip.w;
+		glm::vec2 px = glm::vec2(
+			(clip.x * inv_w * 0.5f + 0.5f) * float(Width),
+			(clip.y * inv_w * 0.5f + 0.5f) * float(Height));
+		lo = glm::min(lo, px);
+		hi = glm::max(hi, px);
+		nearest = std::max(nearest, inv_w);
+	}
+
+	//all corners beyond one side of the view:
+	if (outside_left == 8 || outside_right == 8 || outside_below == 8 || outside_above == 8) return false;
+
+	//reaches behind the eye, so its projection isn't bounded by the corners:
+	if (behind) return true;
+
+	//pixels whose centers the box might cover:
+	int32_t x0 = std::max(0, int32_t(std::floor(lo.x - 0.5f)));
+	int32_t x1 = std::min(int32_t(Width) - 1, int32_t(std::ceil(hi.x - 0.5f)));
+	int32_t y0 = std::max(0, int32_t(std::floor(lo.y - 0.5f)));
+	int32_t y1 = std::min(int32_t(Height) - 1, int32_t(std::ceil(hi.y - 0.5f)));
+	if (x0 > x1 || y0 > y1) return true; //(off the buffer, but not entirely outside the view -- e.g., very thin)
+
+	//hidden if every covered pixel has an occluder nearer than the box's nearest point:
+	constexpr int32_t T = int32_t(Tile);
+	constexpr int32_t TilesX = int32_t(Width / Tile);
+	for (int32_t ty = y0 / T; ty <= y1 / T; ++ty) {
+		for (int32_t tx = x0 / T; tx <= x1 / T; ++tx) {
+			if (tiles[ty * TilesX + tx] > nearest) continue; //whole tile is in front
+
+			//check just the covered part of the tile:
+			int32_t px0 = std::max(x0, tx * T), px1 = std::min(x1, tx * T + T - 1);
+			int32_t py0 = std::max(y0, ty * T), py1 = std::min(y1, ty * T + T - 1);
+			for (int32_t y = py0; y <= py1; ++y) {
+				for (int32_t x = px0; x <= px1; ++x) {
+					if (depth[y * Width + x] <= nearest) return true;
+				}
+			}
+		}
+	}
+	return false;
+}
+
+void OcclusionCuller::cull(std::vector< Scene::DrawItem > &items) {
+	PROFILE_ZONE("OcclusionCuller::cull");
+
+	tested = 0;
+	culled = 0;
+	if (!enabled) return;
+
+	//test in parallel, in small batches:
+	constexpr uint32_t Batch = 64;
+	keep.assign(items.size(), 1);
+	std::function< void(uint32_t) > test = [&](uint32_t index) {
+		uint32_t end = std::min(uint32_t(items.size()), (index + 1) * Batch);
+		for (uint32_t i = index * Batch; i < end; ++i) {
+			Scene::Drawable const &drawable = *items[i].drawable;
+			if (!(drawable.min.x <= drawable.max.x)) continue; //no bounds
+			keep[i] = visible(items[i].clip_from_object, drawable.min, drawable.max);
+		}
+	};
+	workers->run((uint32_t(items.size()) + Batch - 1) / Batch, test);
+
+	//remove hidden items (keeping order):
+	uint32_t out = 0;
+	for (uint32_t i = 0; i < items.size(); ++i) {
+		if (items[i].drawable->min.x <= items[i].drawable->max.x) ++tested;
+		if (keep[i]) items[out++] = items[i];
+	}
+	culled = uint32_t(items.size()) - out;
+	items.resize(out);
+
+	PerfStats::counters.culled_draws += culled;
+}
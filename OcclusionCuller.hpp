@@ -0,0 +1,92 @@
+#pragma once
+
+/*
+ * OcclusionCuller keeps Scene::draw from submitting drawables that are
+ *  outside the view or hidden behind big, simple occluders (e.g., buildings):
+ *
+ * //once:
+ * occlusion_culler.occluders.emplace_back(OcclusionCuller::Box{min, max});
+ * scene.cull = [this](std::vector< Scene::DrawItem > &items) { occlusion_culler.cull(items); };
+ *
+ * //every frame, before drawing:
+ * occlusion_culler.render(clip_from_world); //(the same view Scene::draw will use)
+ * scene.draw(camera);
+ *
+ * render() rasterizes the occluder boxes on the CPU into a small depth buffer
+ *  (Width x Height; depth is stored as 1/w, so bigger is nearer) and then
+ *  records the farthest depth in each Tile x Tile block (a one-level
+ *  hierarchical Z buffer). The buffer is split into horizontal bands, each
+ *  rasterized (four pixels at a time, with SSE2 where available) by a
+ *  different worker thread.
+ *
+ * cull() tests each drawable's bounding box (Drawable::min/max): the box is
+ *  projected to a screen rectangle and its nearest depth, which is compared
+ *  against the blocks under the rectangle, and then against the pixels of
+ *  any block that doesn't settle it. Drawables without bounds, and boxes
+ *  that reach behind the camera, are always kept.
+ *
+ * Occluders must lie inside the geometry they stand for (or they'll hide
+ *  things that should show through).
+ *
+ */
+
+#include "Scene.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct OcclusionCuller {
+	//threads: workers besides the calling thread (default: a few, if the machine has the cores):
+	OcclusionCuller(uint32_t threads = -1U);
+	~OcclusionCuller();
+	OcclusionCuller(OcclusionCuller const &) = delete;
+	OcclusionCuller &operator=(OcclusionCuller const &) = delete;
+
+	//world-space boxes that hide what's behind them:
+	struct Box {
+		glm::vec3 min;
+		glm::vec3 max;
+	};
+	std::vector< Box > occluders;
+
+	//if false, cull() keeps everything:
+	bool enabled = true;
+
+	//rasterize occluders as seen through 'clip_from_world':
+	void render(glm::mat4 const &clip_from_world);
+
+	//remove items that can't be seen (keeps the rest in order; meant for Scene::cull):
+	void cull(std::vector< Scene::DrawItem > &items);
+
+	//can any of the object-space box [min,max] be seen? (as of the last render())
+	bool visible(glm::mat4 const &clip_from_object, glm::vec3 const &min, glm::vec3 const &max) const;
+
+	//stats from the last cull():
+	uint32_t tested = 0;
+	uint32_t culled = 0;
+
+	//-- internals ---
+	static constexpr uint32_t Width = 256;
+	static constexpr uint32_t Height = 128;
+	static constexpr uint32_t Tile = 8;
+	static constexpr uint32_t Band = 32; //rows rasterized per job
+	static_assert(Width % Tile == 0 && Height % Band == 0 && Band % Tile == 0, "Bands are made of whole tiles.");
+	static_assert(Tile % 4 == 0, "Tiles are made of whole SIMD groups.");
+
+	std::vector< float > depth; //Width x Height, 1/w (0 == nothing drawn)
+	std::vector< float > tiles; //(Width / Tile) x (Height / Tile), farthest depth in each tile
+
+	//this frame's occluder triangles, in pixels (x, y) and 1/w (z), front faces only:
+	struct Triangle {
+		glm::vec3 a, b, c;
+	};
+	std::vector< Triangle > triangles;
+
+	std::vector< uint8_t > keep; //cull() scratch space
+
+	struct Workers;
+	std::unique_ptr< Workers > workers;
+};
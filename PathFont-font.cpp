@@ -1595,5 +1595,41 @@ namespace {
 		0.357675f, 0.546999f, 0.357675f, 0.546999f, 0.380799f, 0.530776f,
 		0.380799f, 0.530776f, 0.407815f, 0.504100f
 	};
+	constexpr const uint16_t font_ascii_glyphs[128] = {
+		65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+		65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+		65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 1, 2, 3,
+		4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+		28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+		40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+		52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+		64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+		76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+		88, 89, 90, 91, 92, 93, 94, 65535
+	};
+	constexpr const PathFont::TrieNode font_trie[96] = {
+		{0, 95, 65535, 1}, {32, 0, 0, 96}, {33, 0, 1, 96}, {34, 0, 2, 96}, {35, 0, 3, 96}, {36, 0, 4, 96},
+		{37, 0, 5, 96}, {38, 0, 6, 96}, {39, 0, 7, 96}, {40, 0, 8, 96}, {41, 0, 9, 96}, {42, 0, 10, 96},
+		{43, 0, 11, 96}, {44, 0, 12, 96}, {45, 0, 13, 96}, {46, 0, 14, 96}, {47, 0, 15, 96}, {48, 0, 16, 96},
+		{49, 0, 17, 96}, {50, 0, 18, 96}, {51, 0, 19, 96}, {52, 0, 20, 96}, {53, 0, 21, 96}, {54, 0, 22, 96},
+		{55, 0, 23, 96}, {56, 0, 24, 96}, {57, 0, 25, 96}, {58, 0, 26, 96}, {59, 0, 27, 96}, {60, 0, 28, 96},
+		{61, 0, 29, 96}, {62, 0, 30, 96}, {63, 0, 31, 96}, {64, 0, 32, 96}, {65, 0, 33, 96}, {66, 0, 34, 96},
+		{67, 0, 35, 96}, {68, 0, 36, 96}, {69, 0, 37, 96}, {70, 0, 38, 96}, {71, 0, 39, 96}, {72, 0, 40, 96},
+		{73, 0, 41, 96}, {74, 0, 42, 96}, {75, 0, 43, 96}, {76, 0, 44, 96}, {77, 0, 45, 96}, {78, 0, 46, 96},
+		{79, 0, 47, 96}, {80, 0, 48, 96}, {81, 0, 49, 96}, {82, 0, 50, 96}, {83, 0, 51, 96}, {84, 0, 52, 96},
+		{85, 0, 53, 96}, {86, 0, 54, 96}, {87, 0, 55, 96}, {88, 0, 56, 96}, {89, 0, 57, 96}, {90, 0, 58, 96},
+		{91, 0, 59, 96}, {92, 0, 60, 96}, {93, 0, 61, 96}, {94, 0, 62, 96}, {95, 0, 63, 96}, {96, 0, 64, 96},
+		{97, 0, 65, 96}, {98, 0, 66, 96}, {99, 0, 67, 96}, {100, 0, 68, 96}, {101, 0, 69, 96}, {102, 0, 70, 96},
+		{103, 0, 71, 96}, {104, 0, 72, 96}, {105, 0, 73, 96}, {106, 0, 74, 96}, {107, 0, 75, 96}, {108, 0, 76, 96},
+		{109, 0, 77, 96}, {110, 0, 78, 96}, {111, 0, 79, 96}, {112, 0, 80, 96}, {113, 0, 81, 96}, {114, 0, 82, 96},
+		{115, 0, 83, 96}, {116, 0, 84, 96}, {117, 0, 85, 96}, {118, 0, 86, 96}, {119, 0, 87, 96}, {120, 0, 88, 96},
+		{121, 0, 89, 96}, {122, 0, 90, 96}, {123, 0, 91, 96}, {124, 0, 92, 96}, {125, 0, 93, 96}, {126, 0, 94, 96}
+	};
+	constexpr const PathFont::SDF font_sdf = {
+		"PathFont-sdf.png", 16,
+		{-0.250000f, -0.750000f}, {1.000000f, 1.250000f},
+		0.250000f
+	};
 }
-PathFont PathFont::font(font_glyphs, font_glyph_widths, font_glyph_char_starts, font_chars, font_glyph_coord_starts, font_coords);
+constinit const PathFont PathFont::font(font_glyphs, font_glyph_widths, font_glyph_char_starts, font_chars, font_glyph_coord_starts, font_coords, font_ascii_glyphs, font_trie, font_sdf);
@@ -3,22 +3,23 @@
 
 #include "PathFont.hpp"
 
-#include <iostream>
+uint32_t PathFont::find_glyph_in_trie(char const *begin, char const *end, uint32_t *length) const {
+	uint32_t glyph = NoGlyph;
+	*length = 1;
 
-PathFont::PathFont(uint32_t glyphs_,
-	const float *glyph_widths_,
-	const uint32_t *glyph_char_starts_, const uint8_t *chars_,
-	const uint32_t *glyph_coord_starts_, const float *coords_
-	) : glyphs(glyphs_),
-		glyph_widths(glyph_widths_),
-		glyph_char_starts(glyph_char_starts_), chars(chars_),
-		glyph_coord_starts(glyph_coord_starts_), coords(coords_) {
+	TrieNode const *node = &trie[0];
+	for (char const *at = begin; at != end; ++at) {
+		//children are few (and sorted by byte), so just scan them:
+		TrieNode const *child = trie + node->first_child;
+		TrieNode const *child_end = child + node->children;
+		while (child != child_end && child->byte < uint8_t(*at)) ++child;
+		if (child == child_end || child->byte != uint8_t(*at)) break;
 
-	for (uint32_t i = 0; i < glyphs; ++i) {
-		std::string str(reinterpret_cast< const char * >(chars + glyph_char_starts[i]), reinterpret_cast< const char * >(chars + glyph_char_starts[i+1]));
-		auto res = glyph_map.insert(std::make_pair(str, i));
-		if (!res.second) {
-			std::cerr << "WARNING: ignoring duplicate glyph for '" << str << "'." << std::endl;
+		node = child;
+		if (node->glyph != NoGlyph) {
+			glyph = node->glyph;
+			*length = uint32_t(at + 1 - begin);
 		}
 	}
+	return glyph;
 }
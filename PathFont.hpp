@@ -6,21 +6,49 @@
  * Based on code from Chesskoban (c) 2017-2019 Jim McCann;
  * this adapted-for-15-466 code is released into the public domain.
  *
+ * All of the font's tables (including the ones used to find glyphs) are
+ *  generated by make-PathFont-font.py as constant data, so there's nothing
+ *  to build at startup.
+ *
  */
 
 #include <glm/glm.hpp>
 
-#include <string>
-#include <vector>
-#include <map>
+#include <cstdint>
 
 struct PathFont {
+	//glyph names are looked up in a trie; each node's children are nodes [first_child, first_child + children):
+	struct TrieNode {
+		uint8_t byte; //last byte of the name this node stands for
+		uint8_t children;
+		uint16_t glyph; //glyph with this name (or NoGlyph)
+		uint16_t first_child;
+	};
+	static_assert(sizeof(TrieNode) == 6, "TrieNode is packed.");
+
+	//distance field atlas of the glyphs (made by make-PathFont-font.py; used by DrawSDFText):
+	struct SDF {
+		char const *atlas; //8-bit image in the data directory (see data_path)
+		uint32_t columns; //glyph i is in cell (i % columns, i / columns), counting up from the lower left
+		float cell_min[2]; //area covered by each cell, relative to the glyph's anchor, in font units
+		float cell_max[2];
+		float range; //distance (in font units) to the nearest line that is stored as 1.0
+	};
+
 	//meant to be intitialized with some pointers to constant data:
-	PathFont(uint32_t glyphs,
-		const float *glyph_widths,
-		const uint32_t *glyph_char_starts, const uint8_t *chars,
-		const uint32_t *glyph_coord_starts, const float *coords
-		);
+	constexpr PathFont(uint32_t glyphs_,
+		const float *glyph_widths_,
+		const uint32_t *glyph_char_starts_, const uint8_t *chars_,
+		const uint32_t *glyph_coord_starts_, const float *coords_,
+		const uint16_t *ascii_glyphs_, const TrieNode *trie_,
+		SDF const &sdf_
+		) : glyphs(glyphs_),
+			glyph_widths(glyph_widths_),
+			glyph_char_starts(glyph_char_starts_), chars(chars_),
+			glyph_coord_starts(glyph_coord_starts_), coords(coords_),
+			ascii_glyphs(ascii_glyphs_), trie(trie_),
+			sdf(sdf_) {
+	}
 	const uint32_t glyphs = 0;
 	const float *glyph_widths = nullptr;
 
@@ -30,10 +58,26 @@ struct PathFont {
 	const uint32_t *glyph_coord_starts = nullptr; //indices into 'coords' table
 	const float *coords = nullptr;
 
-	//computed in constructor:
-	std::map< std::string, uint32_t > glyph_map;
+	//glyph lookup tables:
+	static constexpr uint16_t NoGlyph = 0xffff; //no glyph's name starts here
+	static constexpr uint16_t UseTrie = 0xfffe; //some glyph's name is longer than this one byte
+	const uint16_t *ascii_glyphs = nullptr; //[128] -- glyph for each one-byte ASCII name, NoGlyph, or UseTrie
+	const TrieNode *trie = nullptr; //trie[0] is the root (the empty name)
+
+	//find the glyph with the longest name that starts [begin, end):
+	// returns the glyph (or NoGlyph, in which case 'length' is 1) and sets 'length' to the number of bytes it covers.
+	uint32_t find_glyph(char const *begin, char const *end, uint32_t *length) const {
+		uint8_t c = uint8_t(*begin);
+		if (c < 128 && ascii_glyphs[c] != UseTrie) {
+			*length = 1;
+			return ascii_glyphs[c];
+		}
+		return find_glyph_in_trie(begin, end, length);
+	}
+	uint32_t find_glyph_in_trie(char const *begin, char const *end, uint32_t *length) const;
+
+	const SDF sdf;
 
 	//the default font:
-	static PathFont font;
+	static const PathFont font;
 };
-
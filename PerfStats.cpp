@@ -0,0 +1,221 @@
+#include "PerfStats.hpp"
+
+#include "DrawLines.hpp"
+#include "DrawSDFText.hpp"
+#include "GL.hpp"
+#include "Profiler.hpp"
+#include "GPUTimer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+PerfStats::Counters PerfStats::counters;
+std::array< PerfStats::Frame, PerfStats::History > PerfStats::history;
+uint64_t PerfStats::frames = 0;
+bool PerfStats::show_hud = false;
+
+//------ allocation counting ------
+//Replacing the global operator new (and its matching deletes) lets every heap allocation be counted.
+// (the array and nothrow forms call these by default, so they are counted too)
+
+static std::atomic< uint64_t > allocations(0);
+
+void *operator new(std::size_t size) {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (size == 0) size = 1;
+	while (true) {
+		if (void *ptr = std::malloc(size)) return ptr;
+		std::new_handler handler = std::get_new_handler();
+		if (!handler) throw std::bad_alloc();
+		handler();
+	}
+}
+
+void operator delete(void *ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+uint64_t PerfStats::allocation_count() {
+	return allocations.load(std::memory_order_relaxed);
+}
+
+//------ counting ------
+
+void PerfStats::count_draw(uint32_t type, uint32_t count) {
+	counters.draw_calls += 1;
+	if (type == GL_TRIANGLES) counters.triangles += count / 3;
+	else if ((type == GL_TRIANGLE_STRIP || type == GL_TRIANGLE_FAN) && count >= 3) counters.triangles += count - 2;
+}
+
+void PerfStats::end_frame(Frame frame) {
+	static uint64_t allocations_before = allocation_count();
+	uint64_t allocations_now = allocation_count();
+
+	frame.counters = counters;
+	frame.counters.allocations = allocations_now - allocations_before;
+	allocations_before = allocations_now;
+
+	history[frames % History] = frame;
+	frames += 1;
+
+	counters = Counters();
+}
+
+//------ overlay ------
+
+void PerfStats::draw_hud(glm::uvec2 const &drawable_size) {
+	PROFILE_ZONE("PerfStats::draw_hud");
+	if (drawable_size.x == 0 || drawable_size.y == 0) return;
+	uint64_t begin_ns = Profiler::now_ns();
+	uint64_t begin_allocations = allocation_count();
+
+	uint32_t count = uint32_t(std::min< uint64_t >(frames, History));
+	auto frame = [&](uint32_t i) -> Frame const & { //i-th oldest frame in history
+		return history[(frames - count + i) % History];
+	};
+
+	glDisable(GL_DEPTH_TEST);
+
+	{ //everything goes in two batches -- lines for the graph, quads for the text:
+		//(pixel coordinates, origin at lower left)
+		glm::mat4 pixels_to_clip(
+			2.0f / drawable_size.x, 0.0f, 0.0f, 0.0f,
+			0.0f, 2.0f / drawable_size.y, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			-1.0f, -1.0f, 0.0f, 1.0f
+		);
+		DrawLines lines(pixels_to_clip);
+		lines.attribs.reserve(History * 8 + 64);
+		DrawSDFText texts(pixels_to_clip);
+		texts.attribs.reserve(4096);
+
+		constexpr float Margin = 10.0f;
+		constexpr float PixelsPerMs = 2.0f;
+		constexpr float GraphHeight = 50.0f * PixelsPerMs;
+		glm::vec2 at = glm::vec2(Margin, float(drawable_size.y) - Margin - GraphHeight);
+
+		{ //frame time graph -- one stacked bar per frame (events, update, draw, swap from bottom to top):
+			glm::u8vec4 const colors[4] = {
+				glm::u8vec4(0xff, 0xff, 0xff, 0xff), //events
+				glm::u8vec4(0x44, 0xdd, 0x44, 0xff), //update
+				glm::u8vec4(0x44, 0x99, 0xff, 0xff), //draw
+				glm::u8vec4(0x88, 0x88, 0x88, 0xff), //swap
+			};
+			for (uint32_t i = 0; i < count; ++i) {
+				Frame const &f = frame(i);
+				float const ms[4] = { f.events_ms, f.update_ms, f.draw_ms, f.swap_ms };
+				float x = at.x + float(History - count + i) + 0.5f;
+				float y = at.y;
+				for (uint32_t s = 0; s < 4; ++s) {
+					float top = std::min(at.y + GraphHeight, y + ms[s] * PixelsPerMs);
+					if (top > y) lines.draw(glm::vec3(x, y, 0.0f), glm::vec3(x, top, 0.0f), colors[s]);
+					y = top;
+				}
+			}
+			//reference lines at 60 and 30 fps, plus a frame around the graph:
+			auto hline = [&](float ms, glm::u8vec4 color) {
+				float y = at.y + ms * PixelsPerMs;
+				lines.draw(glm::vec3(at.x, y, 0.0f), glm::vec3(at.x + History, y, 0.0f), color);
+			};
+			hline(1000.0f / 60.0f, glm::u8vec4(0xff, 0xdd, 0x00, 0xff));
+			hline(1000.0f / 30.0f, glm::u8vec4(0xff, 0x22, 0x22, 0xff));
+			lines.draw_box(glm::mat4x3(
+				0.5f * History, 0.0f, 0.0f,
+				0.0f, 0.5f * GraphHeight, 0.0f,
+				0.0f, 0.0f, 0.0f,
+				at.x + 0.5f * History, at.y + 0.5f * GraphHeight, 0.0f
+			), glm::u8vec4(0x00, 0x00, 0x00, 0xff));
+		}
+
+		//text, drawn with a drop shadow so it reads over any background:
+		constexpr float H = 14.0f;
+		static std::string line; //(reused so drawing text doesn't allocate)
+		char buffer[128];
+		auto text = [&]() {
+			line.assign(buffer);
+			at.y -= 1.4f * H;
+			texts.draw_text(line, glm::vec3(at.x + 1.0f, at.y - 1.0f, 0.0f), glm::vec3(H, 0.0f, 0.0f), glm::vec3(0.0f, H, 0.0f), glm::u8vec4(0x00, 0x00, 0x00, 0xff));
+			texts.draw_text(line, glm::vec3(at.x, at.y, 0.0f), glm::vec3(H, 0.0f, 0.0f), glm::vec3(0.0f, H, 0.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
+		};
+
+		if (count == 0) {
+			std::snprintf(buffer, sizeof(buffer), "(no frames yet)");
+			text();
+		} else {
+			Frame const &last = frame(count - 1);
+			float total = 0.0f;
+			float worst = 0.0f;
+			for (uint32_t i = 0; i < count; ++i) {
+				total += frame(i).total_ms();
+				worst = std::max(worst, frame(i).total_ms());
+			}
+			float average = total / float(count);
+
+			std::snprintf(buffer, sizeof(buffer), "frame %5.2fms  avg %5.2fms (%.0f fps)  max %5.2fms",
+				last.total_ms(), average, (average > 0.0f ? 1000.0f / average : 0.0f), worst);
+			text();
+			std::snprintf(buffer, sizeof(buffer), "events %.2f  update %.2f  draw %.2f  swap %.2f ms",
+				last.events_ms, last.update_ms, last.draw_ms, last.swap_ms);
+			text();
+			std::snprintf(buffer, sizeof(buffer), "draw calls %u (%u culled)  triangles %llu",
+				last.counters.draw_calls, last.counters.culled_draws, (unsigned long long)last.counters.triangles);
+			text();
+			std::snprintf(buffer, sizeof(buffer), "state changes %u  uniforms %u  uploads %u (%.1f KB)",
+				last.counters.state_changes, last.counters.uniform_uploads, last.counters.buffer_uploads,
+				float(last.counters.bytes_uploaded) / 1024.0f);
+			text();
+			{ //gpu time per section name:
+				int used = std::snprintf(buffer, sizeof(buffer), "gpu");
+				std::vector< GPUTimer::Section > const &sections = GPUTimer::results();
+				for (uint32_t i = 0; i < sections.size(); ++i) {
+					bool seen = false;
+					for (uint32_t j = 0; j < i; ++j) {
+						if (std::strcmp(sections[j].name, sections[i].name) == 0) seen = true;
+					}
+					if (seen) continue;
+					float ms = 0.0f;
+					for (uint32_t j = i; j < sections.size(); ++j) {
+						if (std::strcmp(sections[j].name, sections[i].name) == 0) ms += sections[j].ms;
+					}
+					if (used >= 0 && size_t(used) < sizeof(buffer)) {
+						used += std::snprintf(buffer + used, sizeof(buffer) - used, "  %s %.3fms", sections[i].name, ms);
+					}
+				}
+				if (sections.empty()) std::snprintf(buffer, sizeof(buffer), "gpu (no timings yet)");
+				text();
+			}
+#ifdef GL_TRACE
+			{ //most-called GL functions (F9 prints them all):
+				static std::vector< GLTrace::Stat > hottest;
+				hottest = GLTrace::hottest(4);
+				int used = std::snprintf(buffer, sizeof(buffer), "gl");
+				for (GLTrace::Stat const &stat : hottest) {
+					if (used >= 0 && size_t(used) < sizeof(buffer)) {
+						used += std::snprintf(buffer + used, sizeof(buffer) - used, "  %s %llu", stat.name, (unsigned long long)stat.calls);
+					}
+				}
+				text();
+			}
+#endif
+			std::snprintf(buffer, sizeof(buffer), "collider tests %llu",
+				(unsigned long long)last.counters.collider_tests);
+			text();
+			std::snprintf(buffer, sizeof(buffer), "allocations %llu (+%llu for this overlay, %.3fms)",
+				(unsigned long long)(last.counters.allocations - last.counters.hud_allocations),
+				(unsigned long long)last.counters.hud_allocations, last.counters.hud_ms);
+			text();
+		}
+	} //<-- DrawSDFText and DrawLines destructors submit the batches here
+
+	counters.hud_ms += float(Profiler::now_ns() - begin_ns) * 1e-6f;
+	counters.hud_allocations += allocation_count() - begin_allocations;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+/*
+ * PerfStats collects per-frame performance numbers and can draw them as an
+ *  overlay ("HUD") -- toggle it with F3 in the game.
+ *
+ * The main loop times each phase of the frame and calls end_frame(); code
+ *  elsewhere adds to PerfStats::counters as it works (e.g., Scene::draw counts
+ *  draw calls and GL state changes). Heap allocations are counted by replacing
+ *  the global operator new (see PerfStats.cpp). GPU-side timings come from
+ *  GPUTimer.
+ *
+ * Counters are only meant to be touched from the main (rendering) thread.
+ *
+ */
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace PerfStats {
+	//things counted during a frame:
+	struct Counters {
+		uint32_t draw_calls = 0;
+		uint32_t culled_draws = 0; //drawables Scene::draw skipped as hidden or out of view
+		uint64_t triangles = 0;
+		uint32_t state_changes = 0; //program, vertex array, and texture binds
+		uint32_t uniform_uploads = 0; //glUniform* calls
+		uint32_t buffer_uploads = 0; //glBufferData / glTexImage* calls
+		uint64_t bytes_uploaded = 0;
+		uint64_t collider_tests = 0;
+		uint64_t allocations = 0; //heap allocations (filled in by end_frame)
+		uint64_t hud_allocations = 0; //...of which the HUD itself made
+		float hud_ms = 0.0f; //time spent building + drawing the HUD
+	};
+	//counters for the frame in progress:
+	extern Counters counters;
+
+	//add a draw call of 'count' vertices of primitive 'type' (GL_TRIANGLES, etc) to counters:
+	void count_draw(uint32_t type, uint32_t count);
+	inline void count_state_changes(uint32_t count = 1) { counters.state_changes += count; }
+	inline void count_uniform_uploads(uint32_t count = 1) { counters.uniform_uploads += count; }
+	inline void count_upload(uint64_t bytes) { counters.buffer_uploads += 1; counters.bytes_uploaded += bytes; }
+
+	//a finished frame:
+	struct Frame {
+		float events_ms = 0.0f;
+		float update_ms = 0.0f;
+		float draw_ms = 0.0f;
+		float swap_ms = 0.0f;
+		Counters counters;
+
+		float total_ms() const { return events_ms + update_ms + draw_ms + swap_ms; }
+	};
+
+	//the most recent frames (ring buffer; history[frames % History] is the next slot to fill):
+	constexpr uint32_t History = 240;
+	extern std::array< Frame, History > history;
+	extern uint64_t frames; //frames finished so far
+
+	//called by the main loop at the end of every frame:
+	// (fills in frame.counters from 'counters', then resets 'counters')
+	void end_frame(Frame frame);
+
+	//total heap allocations so far (all threads):
+	uint64_t allocation_count();
+
+	//------ overlay ------
+
+	extern bool show_hud;
+
+	//draw the overlay over whatever is in the framebuffer:
+	// (two batches -- DrawLines for the graph and its frame, then DrawSDFText for the text)
+	void draw_hud(glm::uvec2 const &drawable_size);
+}
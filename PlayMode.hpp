@@ -1,8 +1,14 @@
 #include "Mode.hpp"
 
 #include "Scene.hpp"
+#include "World.hpp"
 
 #include "Mesh.hpp"
+#include "LitColorTextureProgram.hpp"
+#include "ClusteredLights.hpp"
+#include "ShadowMap.hpp"
+#include "DynamicResolution.hpp"
+#include "OcclusionCuller.hpp"
 
 #include <glm/glm.hpp>
 
@@ -18,8 +24,6 @@ struct PlayMode : Mode {
 	virtual bool handle_event(SDL_Event const &, glm::uvec2 const &window_size) override;
 	virtual void update(float elapsed) override;
 	virtual void draw(glm::uvec2 const &drawable_size) override;
-	
-	std::list<Scene::Drawable>::iterator new_drawable(Mesh const &mesh, Scene::Transform *tf, PlayMode *pm);
 
 	//----- game state -----
 
@@ -29,11 +33,32 @@ struct PlayMode : Mode {
 		uint8_t pressed = 0;
 	} left, right, down, up, space, jBtn;
 
-	// struct Player;
+	//the game itself (GL-free; see World.hpp):
+	World world;
 
 	//local copy of the game scene (so code can change it during gameplay):
 	Scene scene;
 
+	//a transform + drawable in 'scene' that shows something from 'world':
+	struct Prop {
+		std::list< Scene::Transform >::iterator transform;
+		std::list< Scene::Drawable >::iterator drawable;
+		Scene::Transform *operator->() { return &*transform; }
+	};
+	Prop new_prop(std::string const &mesh_name, std::string const &name);
+	void delete_prop(Prop &prop);
+	//make 'props' have 'count' entries (adding or deleting at the end as needed):
+	void resize_props(std::vector< Prop > &props, size_t count, std::string const &mesh_name, std::string const &name);
+
+	Prop player;
+	Prop medal;
+	Prop ground;
+	std::vector< Prop > buildings, trees, springs;
+	std::vector< Prop > meteors, flames;
+
+	//copy world state into prop transforms:
+	void sync_props();
+
 	//hexapod leg to wobble:
 	Scene::Transform *hip = nullptr;
 	Scene::Transform *upper_leg = nullptr;
@@ -42,8 +67,30 @@ struct PlayMode : Mode {
 	glm::quat upper_leg_base_rotation;
 	glm::quat lower_leg_base_rotation;
 	float wobble = 0.0f;
-	
+
 	//camera:
 	Scene::Camera *camera = nullptr;
 
+	//lights (all in scene.lights; binned each frame so props are lit by the ones near them):
+	Scene::Light *sun = nullptr;
+	std::vector< std::list< Scene::Light >::iterator > meteor_lights, flame_lights;
+	//make 'lights' have one point light riding along with each of 'props':
+	void sync_lights(std::vector< std::list< Scene::Light >::iterator > &lights, std::vector< Prop > const &props, glm::vec3 const &energy);
+	ClusteredLights clustered_lights;
+
+	//shadows from the sun (buildings, trees, and springs never move, so they are cached):
+	ShadowMap shadow_map;
+	std::vector< Scene::Drawable const * > static_casters, dynamic_casters;
+	LitColorTextureProgram const *lit_program = nullptr;
+
+	//skips drawing props hidden behind buildings (toggle with O):
+	OcclusionCuller occlusion_culler;
+
+	//offscreen target for the 3D scene, sized to fit the GPU budget (toggle with R):
+	DynamicResolution dynamic_resolution;
+
+	//debug view of every collider in 'world' (toggle with C):
+	bool show_colliders = false;
+	void draw_colliders(glm::mat4 const &world_to_clip);
+
 };
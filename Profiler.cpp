@@ -0,0 +1,140 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+std::atomic< bool > Profiler::enabled(true);
+
+namespace {
+	struct Event {
+		char const *name;
+		uint64_t begin_ns;
+		uint64_t end_ns;
+	};
+}
+
+//each thread that records a zone (and each named track) gets one of these:
+struct Profiler::Track {
+	uint32_t tid = 0;
+	std::string name;
+	std::mutex mutex; //only contended while write_chrome_trace() is reading
+	uint64_t written = 0; //total events ever recorded; next slot is written % RingSize
+	std::vector< Event > events = std::vector< Event >(Profiler::RingSize);
+};
+
+namespace {
+	//tracks are never freed, so zones from threads that have exited still show up in traces:
+	std::mutex rings_mutex;
+	std::vector< std::unique_ptr< Profiler::Track > > rings;
+
+	Profiler::Track *new_ring(std::string const &name) {
+		std::lock_guard< std::mutex > lock(rings_mutex);
+		rings.emplace_back(std::make_unique< Profiler::Track >());
+		rings.back()->tid = uint32_t(rings.size() - 1);
+		rings.back()->name = (name.empty() ? "thread " + std::to_string(rings.back()->tid) : name);
+		return rings.back().get();
+	}
+
+	Profiler::Track &this_thread_ring() {
+		thread_local Profiler::Track *ring = new_ring("");
+		return *ring;
+	}
+
+	void write_json_string(std::ostream &out, std::string const &str) {
+		out << '"';
+		for (char c : str) {
+			if (c == '"' || c == '\\') out << '\\' << c;
+			else if (uint8_t(c) < 0x20) out << ' ';
+			else out << c;
+		}
+		out << '"';
+	}
+}
+
+uint64_t Profiler::now_ns() {
+	return uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::record(char const *name, uint64_t begin_ns, uint64_t end_ns) {
+	record(&this_thread_ring(), name, begin_ns, end_ns);
+}
+
+Profiler::Track *Profiler::make_track(std::string const &name) {
+	return new_ring(name);
+}
+
+void Profiler::record(Track *track, char const *name, uint64_t begin_ns, uint64_t end_ns) {
+	std::lock_guard< std::mutex > lock(track->mutex);
+	track->events[track->written % RingSize] = Event{name, begin_ns, end_ns};
+	track->written += 1;
+}
+
+void Profiler::set_thread_name(std::string const &name) {
+	Track &ring = this_thread_ring();
+	std::lock_guard< std::mutex > lock(ring.mutex);
+	ring.name = name;
+}
+
+void Profiler::write_chrome_trace(std::string const &filename) {
+	//copy everything out of the rings first, so recording threads aren't held up by file writing:
+	struct Thread {
+		uint32_t tid;
+		std::string name;
+		std::vector< Event > events;
+	};
+	std::vector< Thread > threads;
+	{
+		std::lock_guard< std::mutex > lock(rings_mutex);
+		for (auto const &ring : rings) {
+			std::lock_guard< std::mutex > ring_lock(ring->mutex);
+			Thread &thread = threads.emplace_back();
+			thread.tid = ring->tid;
+			thread.name = ring->name;
+			uint64_t count = std::min< uint64_t >(ring->written, RingSize);
+			thread.events.reserve(count);
+			for (uint64_t i = ring->written - count; i < ring->written; ++i) {
+				thread.events.emplace_back(ring->events[i % RingSize]);
+			}
+		}
+	}
+
+	//trace times are relative to the earliest zone:
+	uint64_t start_ns = -1ULL;
+	for (Thread const &thread : threads) {
+		for (Event const &event : thread.events) {
+			start_ns = std::min(start_ns, event.begin_ns);
+		}
+	}
+
+	std::ofstream out(filename, std::ios::binary);
+	if (!out) throw std::runtime_error("Failed to open '" + filename + "' for writing.");
+	out.setf(std::ios::fixed);
+	out.precision(3);
+
+	//Chrome trace event format: "X" events are complete zones, with times in microseconds:
+	// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+	out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+	bool first = true;
+	for (Thread const &thread : threads) {
+		if (!first) out << ",\n";
+		first = false;
+		out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread.tid << ",\"args\":{\"name\":";
+		write_json_string(out, thread.name);
+		out << "}}";
+		for (Event const &event : thread.events) {
+			out << ",\n{\"name\":";
+			write_json_string(out, event.name);
+			out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread.tid
+			    << ",\"ts\":" << double(event.begin_ns - start_ns) * 1e-3
+			    << ",\"dur\":" << double(event.end_ns - event.begin_ns) * 1e-3 << "}";
+		}
+	}
+	out << "\n]}\n";
+
+	if (!out) throw std::runtime_error("Failed to write trace to '" + filename + "'.");
+}
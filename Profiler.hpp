@@ -0,0 +1,79 @@
+#pragma once
+
+/*
+ * Profiler records how long named blocks of code ("zones") take.
+ *
+ * Mark a zone by putting PROFILE_ZONE at the top of a scope:
+ *
+ * void Scene::draw(...) {
+ *     PROFILE_ZONE("Scene::draw");
+ *     ...
+ * } //<-- zone ends when the scope does
+ *
+ * Each thread (or track) records zones into its own fixed-size ring buffer, so recording
+ *  never allocates and threads don't contend with each other (only with
+ *  write_chrome_trace, briefly). Once a buffer fills, the oldest zones are
+ *  overwritten -- so a trace always holds the most recent few seconds.
+ *
+ * Profiler::write_chrome_trace() writes everything currently in the ring buffers
+ *  as Chrome trace event JSON, which can be opened in chrome://tracing or
+ *  https://ui.perfetto.dev .
+ *
+ * Recording can be switched on and off at runtime with Profiler::enabled
+ *  (a disabled zone costs one relaxed atomic load). To remove zones from
+ *  the build entirely, compile with -DPROFILER_DISABLED .
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Profiler {
+	//is recording turned on?
+	extern std::atomic< bool > enabled;
+
+	//nanoseconds on a monotonic clock:
+	uint64_t now_ns();
+
+	//add a finished zone to the calling thread's ring buffer:
+	// (name must outlive the profiler -- in practice, it's a string literal)
+	void record(char const *name, uint64_t begin_ns, uint64_t end_ns);
+
+	//label the calling thread in traces (default: "thread N"):
+	void set_thread_name(std::string const &name);
+
+	//zones can also go on named tracks that aren't threads (e.g., GPU timings from GPUTimer):
+	// (tracks live as long as the program; record to a track from one thread at a time)
+	struct Track;
+	Track *make_track(std::string const &name);
+	void record(Track *track, char const *name, uint64_t begin_ns, uint64_t end_ns);
+
+	//write all recorded zones (from all threads) as Chrome trace event JSON:
+	// (throws on failure to write the file)
+	void write_chrome_trace(std::string const &filename);
+
+	//number of zones each thread's ring buffer can hold:
+	constexpr uint32_t RingSize = 1 << 16;
+
+	//RAII helper used by PROFILE_ZONE:
+	struct Zone {
+		Zone(char const *name_) : name(name_), begin_ns(enabled.load(std::memory_order_relaxed) ? now_ns() : 0) { }
+		~Zone() {
+			if (begin_ns) record(name, begin_ns, now_ns());
+		}
+		Zone(Zone const &) = delete;
+		Zone &operator=(Zone const &) = delete;
+
+		char const *name;
+		uint64_t begin_ns; //0 if recording was off when the zone started
+	};
+}
+
+#ifdef PROFILER_DISABLED
+#define PROFILE_ZONE(NAME) do { } while (0)
+#else
+#define PROFILE_ZONE_CAT2(A, B) A ## B
+#define PROFILE_ZONE_CAT(A, B) PROFILE_ZONE_CAT2(A, B)
+#define PROFILE_ZONE(NAME) Profiler::Zone PROFILE_ZONE_CAT(profile_zone_, __LINE__)(NAME)
+#endif
@@ -0,0 +1,65 @@
+#include "SDFTextProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+
+Load< SDFTextProgram > sdf_text_program(LoadTagEarly);
+
+SDFTextProgram::SDFTextProgram() {
+	program = gl_compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform mat4 CLIP_FROM_WORLD;\n"
+		"in vec4 Position;\n"
+		"in vec2 TexCoord;\n"
+		"in vec4 Color;\n"
+		"out vec2 texCoord;\n"
+		"out vec4 color;\n"
+		"void main() {\n"
+		"	gl_Position = CLIP_FROM_WORLD * Position;\n"
+		"	texCoord = TexCoord;\n"
+		"	color = Color;\n"
+		"}\n"
+	,
+		//fragment shader:
+		"#version 330\n"
+		"uniform sampler2D TEX;\n"
+		"uniform float RANGE;\n"
+		"uniform float WEIGHT;\n"
+		"in vec2 texCoord;\n"
+		"in vec4 color;\n"
+		"out vec4 fragColor;\n"
+		"void main() {\n"
+		//distance to the nearest line of the glyph, in font units:
+		"	float d = texture(TEX, texCoord).r * RANGE;\n"
+		//edge is smoothed over about one pixel, whatever the text's size on screen:
+		"	float aa = 0.5 * fwidth(d) + 1e-5;\n"
+		"	float coverage = 1.0 - smoothstep(WEIGHT - aa, WEIGHT + aa, d);\n"
+		"	if (coverage <= 0.0) discard;\n"
+		"	fragColor = vec4(color.rgb, color.a * coverage);\n"
+		"}\n"
+	);
+
+	//look up the locations of vertex attributes:
+	Position_vec4 = glGetAttribLocation(program, "Position");
+	TexCoord_vec2 = glGetAttribLocation(program, "TexCoord");
+	Color_vec4 = glGetAttribLocation(program, "Color");
+
+	//look up the locations of uniforms:
+	CLIP_FROM_WORLD_mat4 = glGetUniformLocation(program, "CLIP_FROM_WORLD");
+	RANGE_float = glGetUniformLocation(program, "RANGE");
+	WEIGHT_float = glGetUniformLocation(program, "WEIGHT");
+	GLuint TEX_sampler2D = glGetUniformLocation(program, "TEX");
+
+	//set TEX to always refer to texture binding zero:
+	glUseProgram(program);
+	glUniform1i(TEX_sampler2D, 0);
+	glUseProgram(0);
+
+	GL_ERRORS();
+}
+
+SDFTextProgram::~SDFTextProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+
+//Shader program that draws text quads from PathFont's distance field atlas:
+// (used by DrawSDFText)
+struct SDFTextProgram {
+	SDFTextProgram();
+	~SDFTextProgram();
+
+	GLuint program = 0;
+	//Attribute (per-vertex variable) locations:
+	GLuint Position_vec4 = -1U;
+	GLuint TexCoord_vec2 = -1U;
+	GLuint Color_vec4 = -1U;
+	//Uniform (per-invocation variable) locations:
+	GLuint CLIP_FROM_WORLD_mat4 = -1U;
+	GLuint RANGE_float = -1U; //distance (in font units) stored as 1.0 in the atlas
+	GLuint WEIGHT_float = -1U; //half the stroke width (in font units)
+	//Textures:
+	//TEXTURE0 - distance field atlas
+};
+
+extern Load< SDFTextProgram > sdf_text_program;
@@ -1,10 +1,16 @@
 #include "Scene.hpp"
+#include "DepthProgram.hpp"
+#include "Impostor.hpp"
 
 #include "gl_errors.hpp"
+#include "Profiler.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
 #include "read_write_chunk.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
 #include <fstream>
 
 //-------------------------
@@ -88,8 +94,21 @@ void Scene::draw(Camera const &camera) const {
 }
 
 void Scene::draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from_world) const {
+	PROFILE_ZONE("Scene::draw");
+	GPU_ZONE("Scene::draw");
+
+	//the prepass only works if depth is being tested and written:
+	bool prepass = depth_prepass && glIsEnabled(GL_DEPTH_TEST);
+	GLint depth_func = GL_LESS;
+	GLboolean depth_mask = GL_TRUE;
+	if (prepass) {
+		glGetIntegerv(GL_DEPTH_FUNC, &depth_func);
+		glGetBooleanv(GL_DEPTH_WRITEMASK, &depth_mask);
+		if (!depth_mask) prepass = false;
+	}
 
-	//Iterate through all drawables, sending each one to OpenGL:
+	//Gather drawables (and their clip-space transforms, which both passes use):
+	draw_items.clear();
 	for (auto const &drawable : drawables) {
 		//Reference to drawable's pipeline for convenience:
 		Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
@@ -101,66 +120,219 @@ void Scene::draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from
 		//skip any drawables that don't contain any vertices:
 		if (pipeline.count == 0) continue;
 
+		assert(drawable.transform); //drawables *must* have a transform
+		DrawItem &item = draw_items.emplace_back();
+		item.drawable = &drawable;
+		item.clip_from_object = clip_from_world * glm::mat4(drawable.transform->make_world_from_local());
+		item.depth = item.clip_from_object[3].w;
+		item.start = pipeline.start;
+		item.count = pipeline.count;
+		item.prepassed = prepass && pipeline.CLIP_FROM_OBJECT_mat4 != -1U;
+	}
 
-		//Set shader program:
-		glUseProgram(pipeline.program);
+	if (cull) cull(draw_items);
+
+	GLint viewport[4] = {0, 0, 0, 0};
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	float pixels_per_clip = 0.5f * float(viewport[3]); //(clip y spans two units over the viewport's height)
+
+	//pixels covered by one object-space unit, at the nearest part of an item's bounds (infinite if they reach the eye):
+	// (measured at the nearest corner rather than the center, so the near end of a big drawable -- e.g., the ground -- isn't underestimated)
+	auto pixels_per_unit = [&](DrawItem const &item) {
+		Drawable const &drawable = *item.drawable;
+		glm::mat4 const &m = item.clip_from_object;
+		//smallest clip w over the box's corners (w is linear, so each axis contributes its smaller end):
+		float w = m[3][3];
+		for (uint32_t a = 0; a < 3; ++a) {
+			w += std::min(m[a][3] * drawable.min[a], m[a][3] * drawable.max[a]);
+		}
+		if (w <= 0.0f) return std::numeric_limits< float >::infinity();
+		return glm::length(glm::vec3(m[0][1], m[1][1], m[2][1])) * pixels_per_clip / w;
+	};
 
-		//Set attribute sources:
-		glBindVertexArray(pipeline.vao);
+	//swap drawables that are small on screen for their impostors:
+	impostors.clear();
+	{
+		constexpr float Hysteresis = 0.75f; //impostors switch back once this much bigger than impostor_pixels
+		size_t kept = 0;
+		for (DrawItem const &item : draw_items) {
+			Drawable const &drawable = *item.drawable;
+			if (drawable.impostor && drawable.min.x <= drawable.max.x) {
+				float size = glm::length(drawable.max - drawable.min) * pixels_per_unit(item);
+				drawable.as_impostor = (size < impostor_pixels / (drawable.as_impostor ? Hysteresis : 1.0f));
+				if (drawable.as_impostor) {
+					if (std::find(impostors.begin(), impostors.end(), drawable.impostor) == impostors.end()) {
+						impostors.emplace_back(drawable.impostor);
+					}
+					drawable.impostor->add(drawable.transform->make_world_from_local());
+					continue;
+				}
+			}
+			draw_items[kept++] = item;
+		}
+		draw_items.resize(kept);
+	}
 
-		//Configure program uniforms:
+	//pick levels of detail by how many pixels their error covers:
+	if (lod_pixels > 0.0f) {
+		constexpr float Hysteresis = 0.75f; //coarser levels must be this far under lod_pixels
+		for (DrawItem &item : draw_items) {
+			Drawable const &drawable = *item.drawable;
+			if (!drawable.lods || drawable.lods->empty() || !(drawable.min.x <= drawable.max.x)) continue;
+			std::vector< Mesh::LOD > const &lods = *drawable.lods;
+
+			float scale = pixels_per_unit(item);
+			auto error = [&](uint32_t level) {
+				return (level == 0 ? 0.0f : lods[level-1].error * scale);
+			};
+
+			//(around the eye, scale is infinite, so this settles on level 0)
+			uint32_t level = std::min(drawable.lod, uint32_t(lods.size()));
+			while (level > 0 && error(level) > lod_pixels) --level;
+			while (level < lods.size() && error(level + 1) < Hysteresis * lod_pixels) ++level;
+			drawable.lod = level;
+			if (level > 0) {
+				item.start = lods[level-1].start;
+				item.count = lods[level-1].count;
+			}
+		}
+	}
 
-		//the object-to-world matrix is used in all three of these uniforms:
-		assert(drawable.transform); //drawables *must* have a transform
-		glm::mat4x3 world_from_object = drawable.transform->make_world_from_local();
+	if (sort_front_to_back) {
+		std::stable_sort(draw_items.begin(), draw_items.end(), [](DrawItem const &a, DrawItem const &b) {
+			return a.depth < b.depth;
+		});
+	}
 
-		//CLIP_FROM_OBJECT takes vertices from object space to clip space:
-		if (pipeline.CLIP_FROM_OBJECT_mat4 != -1U) {
-			glm::mat4 clip_from_object = clip_from_world * glm::mat4(world_from_object);
-			glUniformMatrix4fv(pipeline.CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_object));
+	//Depth prepass:
+	if (prepass) {
+		glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+		glUseProgram(depth_program->program);
+		PerfStats::count_state_changes(2);
+
+		GLuint vao = 0;
+		for (DrawItem const &item : draw_items) {
+			if (!item.prepassed) continue;
+			Scene::Drawable::Pipeline const &pipeline = item.drawable->pipeline;
+			if (pipeline.vao != vao) {
+				vao = pipeline.vao;
+				glBindVertexArray(vao);
+				PerfStats::count_state_changes();
+			}
+			glUniformMatrix4fv(depth_program->CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(item.clip_from_object));
+			PerfStats::count_uniform_uploads();
+			glDrawArrays(pipeline.type, item.start, item.count);
+			PerfStats::count_draw(pipeline.type, item.count);
 		}
 
-		//the object-to-light matrix is used in the next two uniforms:
-		glm::mat4x3 light_from_object = light_from_world * glm::mat4(world_from_object);
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+		//depth is already final for prepassed drawables, so they only need to match it:
+		glDepthFunc(GL_EQUAL);
+		glDepthMask(GL_FALSE);
+		PerfStats::count_state_changes(3);
+	}
 
-		//CLIP_FROM_OBJECT takes vertices from object space to light space:
-		if (pipeline.LIGHT_FROM_OBJECT_mat4x3 != -1U) {
-			glUniformMatrix4x3fv(pipeline.LIGHT_FROM_OBJECT_mat4x3, 1, GL_FALSE, glm::value_ptr(light_from_object));
-		}
+	//Iterate through all drawables, sending each one to OpenGL:
+	// (prepassed drawables first, so depth state changes at most once)
+	// (meshes from every MeshBuffer share vertex array objects -- see VertexArena -- so most draws needn't rebind one)
+	GLuint vao = 0;
+	for (uint32_t pass = 0; pass < 2; ++pass) {
+		for (DrawItem const &item : draw_items) {
+			if (item.prepassed != (pass == 0)) continue;
+
+			Scene::Drawable const &drawable = *item.drawable;
+			//Reference to drawable's pipeline for convenience:
+			Scene::Drawable::Pipeline const &pipeline = drawable.pipeline;
+
+			//Set shader program:
+			glUseProgram(pipeline.program);
+			PerfStats::count_state_changes();
+
+			//Set attribute sources:
+			if (pipeline.vao != vao) {
+				vao = pipeline.vao;
+				glBindVertexArray(vao);
+				PerfStats::count_state_changes();
+			}
 
-		//LIGHT_FROM_NORMAL takes normals from object space to light space:
-		if (pipeline.LIGHT_FROM_NORMAL_mat3 != -1U) {
-			glm::mat3 light_from_normal = glm::inverse(glm::transpose(glm::mat3(light_from_object)));
-			glUniformMatrix3fv(pipeline.LIGHT_FROM_NORMAL_mat3, 1, GL_FALSE, glm::value_ptr(light_from_normal));
-		}
+			//Configure program uniforms:
+
+			//CLIP_FROM_OBJECT takes vertices from object space to clip space:
+			if (pipeline.CLIP_FROM_OBJECT_mat4 != -1U) {
+				glUniformMatrix4fv(pipeline.CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(item.clip_from_object));
+				PerfStats::count_uniform_uploads();
+			}
 
-		//set any requested custom uniforms:
-		if (pipeline.set_uniforms) pipeline.set_uniforms();
+			//the object-to-light matrix is used in the next two uniforms:
+			glm::mat4x3 light_from_object = light_from_world * glm::mat4(drawable.transform->make_world_from_local());
 
-		//set up textures:
-		for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
-			if (pipeline.textures[i].texture != 0) {
-				glActiveTexture(GL_TEXTURE0 + i);
-				glBindTexture(pipeline.textures[i].target, pipeline.textures[i].texture);
+			//CLIP_FROM_OBJECT takes vertices from object space to light space:
+			if (pipeline.LIGHT_FROM_OBJECT_mat4x3 != -1U) {
+				glUniformMatrix4x3fv(pipeline.LIGHT_FROM_OBJECT_mat4x3, 1, GL_FALSE, glm::value_ptr(light_from_object));
+				PerfStats::count_uniform_uploads();
+			}
+
+			//LIGHT_FROM_NORMAL takes normals from object space to light space:
+			if (pipeline.LIGHT_FROM_NORMAL_mat3 != -1U) {
+				glm::mat3 light_from_normal = glm::inverse(glm::transpose(glm::mat3(light_from_object)));
+				glUniformMatrix3fv(pipeline.LIGHT_FROM_NORMAL_mat3, 1, GL_FALSE, glm::value_ptr(light_from_normal));
+				PerfStats::count_uniform_uploads();
 			}
-		}
 
-		//draw the object:
-		glDrawArrays(pipeline.type, pipeline.start, pipeline.count);
+			//set any requested custom uniforms:
+			if (pipeline.set_uniforms) pipeline.set_uniforms();
 
-		//un-bind textures:
-		for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
-			if (pipeline.textures[i].texture != 0) {
-				glActiveTexture(GL_TEXTURE0 + i);
-				glBindTexture(pipeline.textures[i].target, 0);
+			//set up textures:
+			for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
+				if (pipeline.textures[i].texture != 0) {
+					glActiveTexture(GL_TEXTURE0 + i);
+					glBindTexture(pipeline.textures[i].target, pipeline.textures[i].texture);
+					PerfStats::count_state_changes();
+				}
 			}
+
+			//draw the object:
+			glDrawArrays(pipeline.type, item.start, item.count);
+			PerfStats::count_draw(pipeline.type, item.count);
+
+			//un-bind textures:
+			for (uint32_t i = 0; i < Drawable::Pipeline::TextureCount; ++i) {
+				if (pipeline.textures[i].texture != 0) {
+					glActiveTexture(GL_TEXTURE0 + i);
+					glBindTexture(pipeline.textures[i].target, 0);
+					PerfStats::count_state_changes();
+				}
+			}
+			glActiveTexture(GL_TEXTURE0);
+		}
+
+		if (pass == 0 && prepass) {
+			//everything else tests (and writes) depth as the caller had it:
+			glDepthFunc(depth_func);
+			glDepthMask(GL_TRUE);
+			PerfStats::count_state_changes(2);
 		}
-		glActiveTexture(GL_TEXTURE0);
+	}
 
+	//impostors last, one instanced draw each:
+	if (!impostors.empty()) {
+		//the eye is the point that clip_from_world sends to w == 0, x == y == 0 (assumes a perspective projection):
+		glm::vec4 eye = glm::inverse(clip_from_world) * glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
+		Light const *sky = nullptr;
+		for (Light const &light : lights) {
+			if (light.type == Light::Hemisphere || light.type == Light::Directional) {
+				sky = &light;
+				break;
+			}
+		}
+		for (Impostor const *impostor : impostors) {
+			impostor->draw(clip_from_world, glm::vec3(eye) / eye.w, sky);
+		}
 	}
 
 	glUseProgram(0);
 	glBindVertexArray(0);
+	PerfStats::count_state_changes(2);
 
 	GL_ERRORS();
 }
@@ -168,6 +340,7 @@ void Scene::draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from
 
 void Scene::load(std::string const &filename,
 	std::function< void(Scene &, Transform *, std::string const &) > const &on_drawable) {
+	PROFILE_ZONE("Scene::load");
 
 	std::ifstream file(filename, std::ios::binary);
 
@@ -337,6 +510,11 @@ void Scene::set(Scene const &other, std::unordered_map< Transform const *, Trans
 	//null transform maps to itself:
 	transform_to_transform.insert(std::make_pair(nullptr, nullptr));
 
+	sort_front_to_back = other.sort_front_to_back;
+	depth_prepass = other.depth_prepass;
+	lod_pixels = other.lod_pixels;
+	cull = other.cull;
+
 	//Copy transforms and store mapping:
 	transforms.clear();
 	for (auto const &t : other.transforms) {
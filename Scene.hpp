@@ -11,10 +11,12 @@
  */
 
 #include "GL.hpp"
+#include "Mesh.hpp"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <limits>
 #include <list>
 #include <memory>
 #include <functional>
@@ -22,6 +24,8 @@
 #include <vector>
 #include <unordered_map>
 
+struct Impostor; //see Impostor.hpp
+
 // Scene is a transformation hierarchy
 struct Scene {
 	struct Transform {
@@ -83,6 +87,18 @@ struct Scene {
 				GLenum target = GL_TEXTURE_2D;
 			} textures[TextureCount];
 		} pipeline;
+
+		//bounding box in the transform's local space, for culling (empty -- the default -- means never culled):
+		glm::vec3 min = glm::vec3( std::numeric_limits< float >::infinity());
+		glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+
+		//(optional) coarser vertex ranges to draw when the drawable is small on screen (e.g., &mesh.lods):
+		std::vector< Mesh::LOD > const *lods = nullptr;
+		mutable uint32_t lod = 0; //level drawn last (0 is pipeline.start/count, i is (*lods)[i-1])
+
+		//(optional) camera-facing billboard to draw instead when the drawable is small on screen (needs bounds):
+		Impostor const *impostor = nullptr;
+		mutable bool as_impostor = false; //drawn as 'impostor' last frame
 	};
 
 	struct Camera {
@@ -133,6 +149,35 @@ struct Scene {
 	//..sometimes, you want to draw with a custom projection matrix and/or light space:
 	void draw(glm::mat4 const &clip_from_world, glm::mat4x3 const &light_from_world = glm::mat4x3(1.0f)) const;
 
+	//how draw() passes drawables to OpenGL (everything it draws is treated as opaque):
+	//draw nearest first (by each transform's origin), so hidden pixels fail the depth test before shading:
+	bool sort_front_to_back = true;
+	//first lay down depth with DepthProgram, then shade with GL_EQUAL so each visible pixel is shaded once:
+	// (only when GL_DEPTH_TEST is on; applies to drawables that have CLIP_FROM_OBJECT, whose
+	//  vertex arrays must have Position at location 0 and whose vertex shader must compute
+	//  gl_Position exactly as DepthProgram does -- see LitColorTextureProgram)
+	bool depth_prepass = false;
+	//draw the coarsest level of detail that is off by less than this many pixels (0 == always full detail):
+	// (drawables with 'lods' and bounds; levels only change when their error crosses this with some margin, so they don't flicker)
+	float lod_pixels = 1.0f;
+	//draw drawables with an 'impostor' as that impostor when their bounds span fewer than this many pixels (0 == never):
+	// (shaded by the first hemisphere or directional light in 'lights', if any)
+	float impostor_pixels = 64.0f;
+
+	//draw() order scratch space (reused between frames):
+	struct DrawItem {
+		Drawable const *drawable;
+		glm::mat4 clip_from_object;
+		float depth; //clip w of the transform's origin (== view depth, for perspective cameras)
+		GLuint start, count; //vertex range (pipeline.start/count, or a level of detail)
+		bool prepassed;
+	};
+	mutable std::vector< DrawItem > draw_items;
+	mutable std::vector< Impostor const * > impostors; //impostors with instances queued this draw()
+
+	//(optional) remove items that can't be seen, before anything is drawn (e.g., OcclusionCuller::cull):
+	std::function< void(std::vector< DrawItem > &items) > cull;
+
 	//add transforms/objects/cameras from a scene file to this scene:
 	// the 'on_drawable' callback gives your code a chance to look up mesh data and make Drawables:
 	// throws on file format errors
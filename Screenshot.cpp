@@ -0,0 +1,390 @@
+#include "Screenshot.hpp"
+
+#include "GL.hpp"
+#include "gl_errors.hpp"
+#include "load_save_png.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+	//a glReadPixels into a pixel pack buffer, tracked until the worker is done with the mapped buffer:
+	struct Readback {
+		GLuint buffer = 0;
+		GLsizeiptr capacity = 0; //bytes allocated for buffer
+		glm::uvec2 size = glm::uvec2(0); //of the pixels being read
+
+		GLsync fence = 0; //signaled once the read is done
+		bool mapped = false;
+		void const *pixels = nullptr; //mapped pointer handed to the worker (null if mapping failed)
+		std::atomic< bool > copied = false; //set by the worker once it no longer needs 'pixels'
+		bool busy = false; //from start_readback() until the buffer is unmapped
+
+		//where the pixels go:
+		std::string filename; //PNG to write; if empty, the next frame of the raw stream
+		PNGSaveOptions png; //how to write the PNG
+		uint64_t sequence = 0; //position in the raw stream
+	};
+
+	void start_readback(Readback &readback, glm::uvec2 const &size, GLenum read_buffer) {
+		GLsizeiptr bytes = GLsizeiptr(size.x) * size.y * 4;
+
+		if (readback.buffer == 0) glGenBuffers(1, &readback.buffer);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+		if (readback.capacity < bytes) {
+			glBufferData(GL_PIXEL_PACK_BUFFER, bytes, nullptr, GL_STREAM_READ);
+			readback.capacity = bytes;
+		}
+
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+		glReadBuffer(read_buffer);
+		glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, nullptr); //(into the bound pixel pack buffer)
+		glReadBuffer(GL_BACK);
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		readback.size = size;
+		readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		readback.mapped = false;
+		readback.pixels = nullptr;
+		readback.copied = false;
+		readback.busy = true;
+	}
+
+	//the worker threads and their queue:
+	std::vector< std::thread > workers;
+	std::mutex jobs_mutex;
+	std::condition_variable jobs_cv;
+	std::deque< std::shared_ptr< Readback > > jobs;
+	bool quit = false;
+
+	//raw stream output (frames are written in sequence order, whichever worker finishes first):
+	// (a frame that finishes early is parked in raw_pending and written by whichever worker finishes
+	//  the frame before it, so workers never wait on each other -- even if there is only one)
+	struct RawFrame {
+		glm::uvec2 size;
+		std::vector< glm::u8vec4 > data;
+	};
+	std::mutex raw_mutex;
+	std::ofstream raw_file;
+	uint64_t raw_next = 0; //next sequence number to write
+	std::map< uint64_t, RawFrame > raw_pending; //finished frames after raw_next, by sequence number
+
+	void work() {
+		Profiler::set_thread_name("capture worker");
+		while (true) {
+			std::shared_ptr< Readback > readback;
+			{
+				std::unique_lock< std::mutex > lock(jobs_mutex);
+				jobs_cv.wait(lock, [](){ return quit || !jobs.empty(); });
+				if (jobs.empty()) break; //(quit, and nothing left to do)
+				readback = jobs.front();
+				jobs.pop_front();
+			}
+
+			//copy out everything needed, since the GL thread will reuse 'readback' once 'copied' is set:
+			std::string filename = readback->filename;
+			PNGSaveOptions png = readback->png;
+			uint64_t sequence = readback->sequence;
+			glm::uvec2 size = readback->size;
+			std::vector< glm::u8vec4 > data;
+			if (readback->pixels) {
+				PROFILE_ZONE("capture copy");
+				data.resize(size.x * size.y);
+				std::memcpy(data.data(), readback->pixels, data.size() * sizeof(data[0]));
+			}
+			readback->copied = true;
+			readback.reset();
+
+			PROFILE_ZONE("capture encode");
+			if (!filename.empty()) {
+				//(rows are in OpenGL's bottom-to-top order; save_png flips them and fixes alpha as it writes)
+				png.opaque = true;
+				if (!data.empty()) save_png(filename, size, data.data(), LowerLeftOrigin, png);
+			} else {
+				if (data.empty()) data.assign(size.x * size.y, glm::u8vec4(0x00, 0x00, 0x00, 0xff)); //(keep the stream's timing if a read failed)
+				for (auto &px : data) {
+					px.a = 0xff;
+				}
+				std::lock_guard< std::mutex > lock(raw_mutex);
+				raw_pending.emplace(sequence, RawFrame{size, std::move(data)});
+				for (auto f = raw_pending.find(raw_next); f != raw_pending.end(); f = raw_pending.find(raw_next)) {
+					RawFrame const &frame = f->second;
+					//write top row first, which is what video tools expect:
+					for (uint32_t row = frame.size.y; row > 0; --row) {
+						raw_file.write(reinterpret_cast< char const * >(&frame.data[(row - 1) * frame.size.x]), frame.size.x * sizeof(frame.data[0]));
+					}
+					raw_pending.erase(f);
+					raw_next += 1;
+				}
+			}
+		}
+	}
+
+	void start_workers(uint32_t count) {
+		{
+			std::lock_guard< std::mutex > lock(jobs_mutex);
+			quit = false;
+		}
+		while (workers.size() < count) {
+			workers.emplace_back(work);
+		}
+	}
+
+	//advance a readback; returns true once it is completely done (and its buffer can be reused):
+	bool advance(std::shared_ptr< Readback > const &readback) {
+		if (!readback->busy) return true;
+
+		if (readback->fence) {
+			//read finished? map the buffer and let a worker copy from it:
+			GLenum status = glClientWaitSync(readback->fence, 0, 0);
+			if (status == GL_TIMEOUT_EXPIRED) return false;
+			glDeleteSync(readback->fence);
+			readback->fence = 0;
+
+			if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffer);
+				readback->pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, GLsizeiptr(readback->size.x) * readback->size.y * 4, GL_MAP_READ_BIT);
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+				readback->mapped = (readback->pixels != nullptr);
+			}
+			if (!readback->mapped) {
+				std::cerr << "WARNING: failed to read back frame" << (readback->filename.empty() ? "" : " for '" + readback->filename + "'") << "." << std::endl;
+			}
+
+			//(queued even if mapping failed, so that the raw stream's sequence keeps moving)
+			std::lock_guard< std::mutex > lock(jobs_mutex);
+			jobs.emplace_back(readback);
+			jobs_cv.notify_one();
+			return false;
+		}
+
+		if (!readback->copied) return false;
+
+		//worker has its own copy of the pixels, so the buffer is free again:
+		if (readback->mapped) {
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffer);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			readback->mapped = false;
+			readback->pixels = nullptr;
+		}
+		readback->busy = false;
+		return true;
+	}
+
+	//one-off screenshots in progress:
+	std::list< std::shared_ptr< Readback > > screenshots;
+
+	//continuous capture:
+	struct {
+		bool active = false; //capturing new frames?
+		Screenshot::Recording settings;
+		std::vector< std::shared_ptr< Readback > > ring; //(kept after stopping until everything in flight is done)
+		uint32_t next_slot = 0;
+		uint64_t frames = 0; //frames seen while recording
+		uint64_t captured = 0;
+		uint64_t dropped = 0; //skipped because the whole ring was busy
+		glm::uvec2 raw_size = glm::uvec2(0); //size of frames in the raw stream
+		uint64_t raw_sent = 0; //frames handed to the raw stream
+	} recording;
+
+	//once recording has stopped and everything in flight is written, clean up and report:
+	void finish_recording() {
+		if (recording.active || recording.ring.empty()) return;
+		for (auto const &readback : recording.ring) {
+			if (readback->busy) return;
+		}
+		if (recording.settings.raw) {
+			std::lock_guard< std::mutex > lock(raw_mutex);
+			if (raw_next != recording.raw_sent) return;
+			raw_file.close();
+		}
+
+		for (auto const &readback : recording.ring) {
+			glDeleteBuffers(1, &readback->buffer);
+		}
+		recording.ring.clear();
+
+		std::cout << "Recorded " << recording.captured << " frame(s) to '" << recording.settings.prefix
+		          << (recording.settings.raw ? ".rgba" : "-*.png") << "'";
+		if (recording.dropped) {
+			std::cout << "; dropped " << recording.dropped << " frame(s) because encoding fell behind"
+			          << " (try a larger ring_size, more encoders, or capturing less often)";
+		}
+		std::cout << "." << std::endl;
+		if (recording.settings.raw && recording.captured) {
+			std::cout << "  (e.g., ffmpeg -f rawvideo -pix_fmt rgba -s " << recording.raw_size.x << "x" << recording.raw_size.y
+			          << " -i " << recording.settings.prefix << ".rgba " << recording.settings.prefix << ".mp4 )" << std::endl;
+		}
+	}
+}
+
+void Screenshot::request(std::string const &filename, glm::uvec2 const &size) {
+	if (size.x == 0 || size.y == 0) return;
+	PROFILE_ZONE("Screenshot::request");
+
+	start_workers(1);
+
+	auto readback = std::make_shared< Readback >();
+	readback->filename = filename;
+	start_readback(*readback, size, GL_FRONT);
+	screenshots.emplace_back(readback);
+
+	GL_ERRORS();
+}
+
+void Screenshot::update() {
+	if (screenshots.empty() && recording.ring.empty()) return;
+	PROFILE_ZONE("Screenshot::update");
+
+	for (auto si = screenshots.begin(); si != screenshots.end(); /* later */) {
+		if (advance(*si)) {
+			glDeleteBuffers(1, &(*si)->buffer);
+			si = screenshots.erase(si);
+		} else {
+			++si;
+		}
+	}
+
+	for (auto const &readback : recording.ring) {
+		advance(readback);
+	}
+	finish_recording();
+
+	GL_ERRORS();
+}
+
+void Screenshot::finish() {
+	stop_recording();
+
+	while (!screenshots.empty() || !recording.ring.empty()) {
+		//(wait briefly on the oldest readback so this doesn't spin)
+		std::shared_ptr< Readback > oldest = (!screenshots.empty() ? screenshots.front() : nullptr);
+		for (auto const &readback : recording.ring) {
+			if (!oldest && readback->busy) oldest = readback;
+		}
+		if (oldest && oldest->fence) {
+			glClientWaitSync(oldest->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); //1ms
+		} else {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		update();
+	}
+
+	{
+		std::lock_guard< std::mutex > lock(jobs_mutex);
+		quit = true;
+	}
+	jobs_cv.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	workers.clear();
+}
+
+void Screenshot::start_recording(Recording const &settings) {
+	if (recording.active) return;
+	if (!recording.ring.empty()) {
+		std::cerr << "WARNING: previous recording is still being written; not starting a new one yet." << std::endl;
+		return;
+	}
+
+	recording.active = true;
+	recording.settings = settings;
+	recording.settings.every = std::max(1u, settings.every);
+	recording.settings.ring_size = std::max(1u, settings.ring_size);
+	recording.next_slot = 0;
+	recording.frames = 0;
+	recording.captured = 0;
+	recording.dropped = 0;
+	recording.raw_size = glm::uvec2(0);
+	recording.raw_sent = 0;
+
+	for (uint32_t i = 0; i < recording.settings.ring_size; ++i) {
+		recording.ring.emplace_back(std::make_shared< Readback >());
+	}
+
+	if (recording.settings.raw) {
+		std::lock_guard< std::mutex > lock(raw_mutex);
+		raw_file.open(recording.settings.prefix + ".rgba", std::ios::binary);
+		raw_next = 0;
+		raw_pending.clear();
+		if (!raw_file) {
+			std::cerr << "WARNING: failed to open '" << recording.settings.prefix << ".rgba' for writing." << std::endl;
+		}
+	}
+
+	uint32_t encoders = settings.encoders;
+	if (encoders == 0) encoders = std::max(1u, std::thread::hardware_concurrency() / 2);
+	start_workers(encoders);
+
+	std::cout << "Recording to '" << recording.settings.prefix << (recording.settings.raw ? ".rgba" : "-*.png") << "'"
+	          << " (every " << recording.settings.every << " frame(s), " << workers.size() << " encoder(s))." << std::endl;
+}
+
+void Screenshot::stop_recording() {
+	if (!recording.active) return;
+	recording.active = false;
+	finish_recording();
+}
+
+bool Screenshot::is_recording() {
+	return recording.active;
+}
+
+void Screenshot::record_frame(glm::uvec2 const &size) {
+	if (!recording.active) return;
+	uint64_t frame = recording.frames;
+	recording.frames += 1;
+	if (frame % recording.settings.every != 0) return;
+	if (size.x == 0 || size.y == 0) return;
+	PROFILE_ZONE("Screenshot::record_frame");
+
+	if (recording.settings.raw) {
+		//a raw stream needs every frame to be the same size:
+		if (recording.raw_size == glm::uvec2(0)) recording.raw_size = size;
+		if (size != recording.raw_size) {
+			recording.dropped += 1;
+			return;
+		}
+	}
+
+	//the ring is used in order, so a busy next slot means encoding has fallen behind:
+	std::shared_ptr< Readback > const &readback = recording.ring[recording.next_slot];
+	if (readback->busy) {
+		recording.dropped += 1;
+		return;
+	}
+	recording.next_slot = (recording.next_slot + 1) % recording.ring.size();
+
+	if (recording.settings.raw) {
+		readback->filename.clear();
+		readback->sequence = recording.raw_sent;
+		recording.raw_sent += 1;
+	} else {
+		//(numbered by frame, so dropped frames show up as gaps)
+		char number[32];
+		std::snprintf(number, sizeof(number), "-%06llu.png", (unsigned long long)(frame / recording.settings.every));
+		readback->filename = recording.settings.prefix + number;
+		readback->png = recording.settings.png;
+	}
+	start_readback(*readback, size, GL_BACK);
+	recording.captured += 1;
+
+	GL_ERRORS();
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+/*
+ * Screenshot saves the contents of the window to a PNG without stalling the game:
+ *
+ *  - request() starts a glReadPixels into a pixel buffer object, which the
+ *    GPU fills in on its own time;
+ *  - update() (called every frame by the main loop) checks whether the
+ *    readback has finished and, if so, maps the buffer and hands it to a
+ *    worker thread;
+ *  - the worker copies the pixels out (so the buffer can be unmapped on the
+ *    next update()), fixes up alpha, and does the (slow) PNG encode and write.
+ *
+ * It can also record every (or every Nth) frame, as a numbered PNG sequence
+ *  or as one raw RGBA stream. Recording reads back through a fixed ring of
+ *  pixel buffers and encodes on a pool of worker threads; if every buffer in
+ *  the ring is still busy when a frame comes along, that frame is dropped
+ *  (and counted) rather than making the game wait.
+ *
+ */
+
+#include "load_save_png.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Screenshot {
+	//start saving the front buffer (i.e., the last frame shown) of the default framebuffer:
+	void request(std::string const &filename, glm::uvec2 const &size);
+
+	//advance any screenshots or recorded frames in progress (call once per frame from the GL thread):
+	void update();
+
+	//finish all work in progress and stop the worker threads (call before destroying the GL context):
+	void finish();
+
+	//------ continuous capture ------
+
+	struct Recording {
+		std::string prefix = "capture"; //writes prefix-000000.png, prefix-000001.png, ... (or prefix.rgba if raw)
+		uint32_t every = 1; //capture every Nth frame
+		bool raw = false; //write frames (top row first) to one raw RGBA file instead of PNGs
+		PNGSaveOptions png = PNGSaveOptions::fast(); //compression for PNG frames (see also PNGSaveOptions::uncompressed())
+		uint32_t ring_size = 4; //frames that can be in flight at once
+		uint32_t encoders = 0; //worker threads (0: half the cores, at least one)
+	};
+
+	void start_recording(Recording const &settings = Recording());
+	void stop_recording(); //frames already captured still get written
+	bool is_recording();
+
+	//call after drawing each frame (before swapping) to capture the back buffer while recording:
+	void record_frame(glm::uvec2 const &size);
+}
@@ -0,0 +1,174 @@
+#include "ShadowMap.hpp"
+#include "DepthProgram.hpp"
+#include "LitColorTextureProgram.hpp"
+
+#include "gl_errors.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
+#include "Profiler.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+//depth texture (compared when sampled, for sampler2DShadow) + framebuffer to render into it:
+static void make_target(uint32_t size, GLuint *texture, GLuint *framebuffer) {
+	glGenTextures(1, texture);
+	glBindTexture(GL_TEXTURE_2D, *texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, size, size, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	//(outside the map counts as unshadowed)
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+	float border[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+	glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, border);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenFramebuffers(1, framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, *framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, *texture, 0);
+	glDrawBuffer(GL_NONE);
+	glReadBuffer(GL_NONE);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		throw std::runtime_error("Shadow map framebuffer is incomplete.");
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+ShadowMap::ShadowMap(uint32_t size_) : size(size_) {
+	make_target(size, &static_texture, &static_framebuffer);
+	make_target(size, &texture, &framebuffer);
+	GL_ERRORS();
+}
+
+ShadowMap::~ShadowMap() {
+	glDeleteFramebuffers(1, &static_framebuffer);
+	glDeleteFramebuffers(1, &framebuffer);
+	glDeleteTextures(1, &static_texture);
+	glDeleteTextures(1, &texture);
+}
+
+//draw casters' depth (binding each vertex array only when it changes):
+static void draw_casters(std::vector< Scene::Drawable const * > const &casters, glm::mat4 const &clip_from_world) {
+	GLuint vao = 0;
+	for (Scene::Drawable const *drawable : casters) {
+		Scene::Drawable::Pipeline const &pipeline = drawable->pipeline;
+		if (pipeline.vao == 0 || pipeline.count == 0) continue;
+		if (pipeline.vao != vao) {
+			vao = pipeline.vao;
+			glBindVertexArray(vao);
+			PerfStats::count_state_changes();
+		}
+		glm::mat4 clip_from_object = clip_from_world * glm::mat4(drawable->transform->make_world_from_local());
+		glUniformMatrix4fv(depth_program->CLIP_FROM_OBJECT_mat4, 1, GL_FALSE, glm::value_ptr(clip_from_object));
+		PerfStats::count_uniform_uploads();
+		glDrawArrays(pipeline.type, pipeline.start, pipeline.count);
+		PerfStats::count_draw(pipeline.type, pipeline.count);
+	}
+	glBindVertexArray(0);
+}
+
+void ShadowMap::render(glm::vec3 const &direction_,
+	std::vector< Scene::Drawable const * > const &static_casters,
+	std::vector< Scene::Drawable const * > const &dynamic_casters) {
+	PROFILE_ZONE("ShadowMap::render");
+	GPU_ZONE("ShadowMap");
+
+	glm::vec3 direction = glm::normalize(direction_);
+	if (direction != static_direction || min != static_min || max != static_max) static_valid = false;
+
+	if (!static_valid) {
+		//fit an orthographic view along 'direction' around the area's corners:
+		glm::vec3 center = 0.5f * (min + max);
+		glm::vec3 up = (std::abs(direction.z) < 0.9f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 view = glm::lookAt(center - direction, center, up);
+		glm::vec3 lo = glm::vec3( std::numeric_limits< float >::infinity());
+		glm::vec3 hi = glm::vec3(-std::numeric_limits< float >::infinity());
+		for (uint32_t c = 0; c < 8; ++c) {
+			glm::vec3 corner = glm::vec3((c & 1 ? max.x : min.x), (c & 2 ? max.y : min.y), (c & 4 ? max.z : min.z));
+			glm::vec3 v = glm::vec3(view * glm::vec4(corner, 1.0f));
+			lo = glm::min(lo, v);
+			hi = glm::max(hi, v);
+		}
+		//(view looks along -z)
+		clip_from_world = glm::ortho(lo.x, hi.x, lo.y, hi.y, -hi.z, -lo.z) * view;
+		shadow_from_world = glm::mat4(
+			0.5f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.5f, 0.0f, 0.0f,
+			0.0f, 0.0f, 0.5f, 0.0f,
+			0.5f, 0.5f, 0.5f, 1.0f
+		) * clip_from_world;
+	}
+
+	//save the state this changes:
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	GLint draw_framebuffer = 0, read_framebuffer = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_framebuffer);
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_framebuffer);
+
+	glViewport(0, 0, size, size);
+	glEnable(GL_DEPTH_TEST);
+	glDepthFunc(GL_LESS);
+	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+	//(slope-scaled bias keeps surfaces from shadowing themselves)
+	glEnable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(2.0f, 4.0f);
+	glUseProgram(depth_program->program);
+
+	if (!static_valid) {
+		glBindFramebuffer(GL_FRAMEBUFFER, static_framebuffer);
+		glClear(GL_DEPTH_BUFFER_BIT);
+		draw_casters(static_casters, clip_from_world);
+		static_valid = true;
+		static_direction = direction;
+		static_min = min;
+		static_max = max;
+		static_renders += 1;
+	}
+
+	//this frame's map: the cached static depth, then dynamic casters on top:
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, static_framebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+	glBlitFramebuffer(0, 0, size, size, 0, 0, size, size, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+	draw_casters(dynamic_casters, clip_from_world);
+
+	glUseProgram(0);
+	glDisable(GL_POLYGON_OFFSET_FILL);
+	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, read_framebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, draw_framebuffer);
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	GL_ERRORS();
+}
+
+void ShadowMap::set_uniforms(LitColorTextureProgram const &program) const {
+	assert(program.variant.shadowed);
+	glUseProgram(program.program);
+	glUniformMatrix4fv(program.SHADOW_FROM_LIGHT_mat4, 1, GL_FALSE, glm::value_ptr(shadow_from_world));
+	glUseProgram(0);
+	PerfStats::count_state_changes(2);
+	PerfStats::count_uniform_uploads();
+}
+
+void ShadowMap::bind() const {
+	glActiveTexture(GL_TEXTURE0 + Unit);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glActiveTexture(GL_TEXTURE0);
+	PerfStats::count_state_changes();
+}
+
+void ShadowMap::unbind() const {
+	glActiveTexture(GL_TEXTURE0 + Unit);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE0);
+	PerfStats::count_state_changes();
+}
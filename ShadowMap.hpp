@@ -0,0 +1,78 @@
+#pragma once
+
+/*
+ * ShadowMap renders a depth map from a sky (directional or hemisphere)
+ *  light, for the shadowed LitColorTextureProgram variants.
+ *
+ * Casters come in two sets:
+ *  - static casters (e.g., ground clutter, buildings, trees) are rendered
+ *    into a cached depth map only when the light direction or area
+ *    changes, or after invalidate();
+ *  - dynamic casters are composited in every frame: the cached map is
+ *    copied (a depth blit), and only they are drawn on top.
+ *
+ * //every frame, before drawing the scene:
+ * shadow_map.render(light_direction, static_casters, dynamic_casters);
+ * shadow_map.set_uniforms(program);
+ * shadow_map.bind(); //(on texture unit 4, which Scene::draw leaves alone)
+ * scene.draw(camera);
+ * shadow_map.unbind();
+ *
+ * Casters are drawn with DepthProgram, using their pipeline's vao and
+ *  vertex range (so vertex array objects need Position at location 0).
+ *
+ */
+
+#include "Scene.hpp"
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+struct LitColorTextureProgram;
+
+struct ShadowMap {
+	ShadowMap(uint32_t size = 2048);
+	~ShadowMap();
+	ShadowMap(ShadowMap const &) = delete;
+	ShadowMap &operator=(ShadowMap const &) = delete;
+
+	//area (in world space) that casts and receives shadows:
+	glm::vec3 min = glm::vec3(-1.0f);
+	glm::vec3 max = glm::vec3( 1.0f);
+
+	//the texture unit bind() uses:
+	static constexpr GLuint Unit = 4;
+
+	//render this frame's map ('direction' is the direction light travels):
+	void render(glm::vec3 const &direction,
+		std::vector< Scene::Drawable const * > const &static_casters,
+		std::vector< Scene::Drawable const * > const &dynamic_casters);
+
+	//static casters changed; re-render them next frame:
+	void invalidate() { static_valid = false; }
+
+	//send SHADOW_FROM_LIGHT to a shadowed LitColorTextureProgram:
+	void set_uniforms(LitColorTextureProgram const &program) const;
+
+	//bind (or unbind) the map to texture unit 'Unit':
+	void bind() const;
+	void unbind() const;
+
+	//stats:
+	uint32_t static_renders = 0; //times the static casters have been rendered
+
+	//-- internals ---
+	uint32_t size;
+	glm::mat4 clip_from_world = glm::mat4(1.0f); //light's view
+	glm::mat4 shadow_from_world = glm::mat4(1.0f); //clip_from_world, remapped to [0,1] texture coordinates and depth
+
+	//cached static casters, and this frame's map:
+	GLuint static_texture = 0, static_framebuffer = 0;
+	GLuint texture = 0, framebuffer = 0;
+
+	bool static_valid = false;
+	glm::vec3 static_direction = glm::vec3(0.0f);
+	glm::vec3 static_min = glm::vec3(0.0f), static_max = glm::vec3(0.0f);
+};
@@ -0,0 +1,380 @@
+#include "Texture.hpp"
+
+#include "gl_errors.hpp"
+#include "load_save_png.hpp"
+#include "mipmaps.hpp"
+#include "read_write_chunk.hpp"
+#include "PerfStats.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+uint64_t Texture::upload_bytes_per_frame = 8 << 20;
+uint64_t Texture::budget_bytes = 256 << 20;
+
+//loading state, shared between the GL thread and the worker:
+struct Texture::Stream {
+	//set up by the GL thread:
+	std::string filename;
+	bool packed = false;
+	uint64_t pixels_offset = 0;
+	std::vector< Level > levels; //copied from the texture for packed files; filled in by the worker for PNGs
+
+	//filled in by the worker:
+	std::vector< glm::u8vec4 > pixels;
+	std::string error; //if not empty, loading failed
+	std::atomic< bool > decoded = false;
+
+	//upload progress (GL thread):
+	uint32_t level = 0; //level being uploaded (counts down from the smallest level)
+	uint32_t row = 0; //next row of that level
+};
+
+namespace {
+	//every texture (for update()):
+	std::vector< Texture * > &get_textures() {
+		static std::vector< Texture * > textures;
+		return textures;
+	}
+
+	uint64_t update_count = 0;
+
+	//the pixel unpack buffer uploads are staged in:
+	GLuint upload_buffer = 0;
+
+	//the worker thread and its queue:
+	std::thread worker;
+	std::mutex jobs_mutex;
+	std::condition_variable jobs_cv;
+	std::deque< std::shared_ptr< Texture::Stream > > jobs;
+	bool quit = false;
+
+	void decode(Texture::Stream &stream) {
+		PROFILE_ZONE("Texture decode");
+		if (stream.packed) {
+			std::ifstream file(stream.filename, std::ios::binary);
+			file.seekg(stream.pixels_offset);
+			read_chunk(file, "rgba", &stream.pixels);
+			Texture::Level const &last = stream.levels.back();
+			if (stream.pixels.size() != size_t(last.offset) + size_t(last.width) * last.height) {
+				throw std::runtime_error("pixel chunk doesn't match mip levels");
+			}
+		} else {
+			glm::uvec2 size;
+			load_png(stream.filename, &size, &stream.pixels, LowerLeftOrigin);
+			std::vector< glm::uvec2 > sizes = make_mipmaps(size, &stream.pixels);
+			uint32_t offset = 0;
+			for (glm::uvec2 const &level : sizes) {
+				stream.levels.emplace_back(Texture::Level{level.x, level.y, offset});
+				offset += level.x * level.y;
+			}
+		}
+	}
+
+	void work() {
+		Profiler::set_thread_name("texture worker");
+		while (true) {
+			std::shared_ptr< Texture::Stream > stream;
+			{
+				std::unique_lock< std::mutex > lock(jobs_mutex);
+				jobs_cv.wait(lock, [](){ return quit || !jobs.empty(); });
+				if (quit) break;
+				stream = jobs.front();
+				jobs.pop_front();
+			}
+			try {
+				decode(*stream);
+			} catch (std::exception &e) {
+				stream->error = e.what();
+				stream->pixels.clear();
+			}
+			stream->decoded = true;
+		}
+	}
+
+	void queue(Texture &texture) {
+		auto stream = std::make_shared< Texture::Stream >();
+		stream->filename = texture.filename;
+		stream->packed = (texture.pixels_offset != 0);
+		stream->pixels_offset = texture.pixels_offset;
+		if (stream->packed) stream->levels = texture.levels;
+		texture.stream = stream;
+
+		std::lock_guard< std::mutex > lock(jobs_mutex);
+		if (!worker.joinable()) {
+			quit = false;
+			worker = std::thread(work);
+		}
+		jobs.emplace_back(stream);
+		jobs_cv.notify_one();
+	}
+
+	//(re-)specify a texture as a 1x1 white placeholder, releasing any larger levels:
+	void make_placeholder(Texture const &texture, uint32_t levels) {
+		glBindTexture(GL_TEXTURE_2D, texture.texture);
+		glm::u8vec4 white(0xff);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+		for (uint32_t l = 1; l < levels; ++l) {
+			glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	//a glTexSubImage2D to issue once the upload buffer is unmapped:
+	struct Upload {
+		Texture *texture;
+		uint32_t level;
+		uint32_t row, rows, width;
+		size_t offset; //in upload_buffer
+		bool finishes_level;
+	};
+}
+
+Texture::Texture(std::string const &filename_) : filename(filename_) {
+	PROFILE_ZONE("Texture load");
+
+	if (filename.size() >= 4 && filename.substr(filename.size()-4) == ".tex") {
+		//read the header chunks now (they're small); leave the pixels for the worker:
+		std::ifstream file(filename, std::ios::binary);
+		if (!file) {
+			throw std::runtime_error("Failed to open texture file '" + filename + "'.");
+		}
+
+		read_chunk(file, "tex0", &levels);
+		if (levels.empty()) {
+			throw std::runtime_error("Texture file '" + filename + "' has no levels.");
+		}
+		uint32_t offset = 0;
+		for (Level const &level : levels) {
+			if (level.width == 0 || level.height == 0 || level.offset != offset) {
+				throw std::runtime_error("Texture file '" + filename + "' has a malformed level.");
+			}
+			offset += level.width * level.height;
+			bytes += uint64_t(level.width) * level.height * 4;
+		}
+		if (levels.back().width != 1 || levels.back().height != 1) {
+			throw std::runtime_error("Texture file '" + filename + "' doesn't have a full mip chain.");
+		}
+
+		std::vector< char > strings;
+		read_chunk(file, "str0", &strings);
+
+		std::vector< RegionEntry > entries;
+		read_chunk(file, "reg0", &entries);
+		glm::vec2 size = glm::vec2(levels[0].width, levels[0].height);
+		for (RegionEntry const &entry : entries) {
+			if (!(entry.name_begin <= entry.name_end && entry.name_end <= strings.size())) {
+				throw std::runtime_error("region entry has out-of-range name begin/end");
+			}
+			std::string name(strings.data() + entry.name_begin, strings.data() + entry.name_end);
+			Region region;
+			region.min = glm::vec2(entry.x, entry.y) / size;
+			region.max = glm::vec2(entry.x + entry.width, entry.y + entry.height) / size;
+			bool inserted = regions.emplace(name, region).second;
+			if (!inserted) {
+				std::cerr << "WARNING: region name '" + name + "' in filename '" + filename + "' collides with existing region." << std::endl;
+			}
+		}
+
+		pixels_offset = uint64_t(file.tellg());
+	} else if (filename.size() >= 4 && filename.substr(filename.size()-4) == ".png") {
+		//nothing to read ahead of time
+	} else {
+		throw std::runtime_error("Unknown file type '" + filename + "'");
+	}
+
+	glGenTextures(1, &texture);
+	make_placeholder(*this, 1);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	GL_ERRORS();
+
+	touched = update_count;
+	get_textures().emplace_back(this);
+	queue(*this);
+}
+
+Texture::~Texture() {
+	auto &textures = get_textures();
+	textures.erase(std::remove(textures.begin(), textures.end(), this), textures.end());
+	glDeleteTextures(1, &texture);
+	texture = 0;
+}
+
+Texture::Region const &Texture::lookup(std::string const &name) const {
+	auto f = regions.find(name);
+	if (f == regions.end()) {
+		throw std::runtime_error("Looking up region '" + name + "' that doesn't exist in '" + filename + "'.");
+	}
+	return f->second;
+}
+
+void Texture::touch() const {
+	touched = update_count;
+}
+
+bool Texture::resident() const {
+	return loaded;
+}
+
+uint64_t Texture::resident_bytes() {
+	uint64_t total = 0;
+	for (Texture const *texture : get_textures()) {
+		if (texture->allocated) total += texture->bytes;
+	}
+	return total;
+}
+
+void Texture::update() {
+	PROFILE_ZONE("Texture::update");
+	update_count += 1;
+
+	auto &textures = get_textures();
+
+	//load anything evicted that is wanted again:
+	for (Texture *texture : textures) {
+		if (!texture->loaded && !texture->stream && texture->touched + 1 >= update_count) {
+			queue(*texture);
+		}
+	}
+
+	//stage rows from finished decodes into the upload buffer, smallest level first:
+	std::vector< Upload > uploads;
+	glm::u8vec4 *mapped = nullptr;
+	size_t used = 0;
+	size_t const capacity = size_t(upload_bytes_per_frame);
+
+	for (Texture *texture : textures) {
+		if (!texture->stream || !texture->stream->decoded) continue;
+		Stream &stream = *texture->stream;
+		if (!stream.error.empty()) {
+			std::cerr << "WARNING: failed to load texture '" << texture->filename << "': " << stream.error << std::endl;
+			stream.error.clear();
+			stream.levels.clear(); //(leaves the stream in place so it isn't retried)
+		}
+		if (stream.levels.empty()) continue;
+
+		if (!texture->allocated) {
+			//the smallest level is 1x1, so it always fits:
+			if (used + sizeof(glm::u8vec4) > capacity) break;
+
+			//specify every level now; only levels from BASE_LEVEL on are ever sampled, and those are uploaded:
+			glBindTexture(GL_TEXTURE_2D, texture->texture);
+			texture->levels = stream.levels;
+			texture->bytes = 0;
+			for (uint32_t l = 0; l < stream.levels.size(); ++l) {
+				Level const &level = stream.levels[l];
+				glTexImage2D(GL_TEXTURE_2D, l, GL_RGBA8, level.width, level.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+				texture->bytes += uint64_t(level.width) * level.height * 4;
+			}
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(stream.levels.size()) - 1);
+			glBindTexture(GL_TEXTURE_2D, 0);
+			texture->allocated = true;
+			stream.level = uint32_t(stream.levels.size()) - 1;
+			stream.row = 0;
+		}
+
+		while (true) {
+			Level const &level = stream.levels[stream.level];
+			size_t row_bytes = size_t(level.width) * sizeof(glm::u8vec4);
+			uint32_t rows = uint32_t(std::min< size_t >(level.height - stream.row, (capacity - used) / row_bytes));
+			if (rows == 0) break;
+
+			if (!mapped) {
+				if (upload_buffer == 0) glGenBuffers(1, &upload_buffer);
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, upload_buffer);
+				//(orphan last frame's storage, so the driver never has to wait for those uploads to finish)
+				glBufferData(GL_PIXEL_UNPACK_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+				mapped = reinterpret_cast< glm::u8vec4 * >(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, capacity, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+				if (!mapped) {
+					glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+					std::cerr << "WARNING: failed to map texture upload buffer." << std::endl;
+					return;
+				}
+			}
+
+			std::memcpy(reinterpret_cast< char * >(mapped) + used, &stream.pixels[level.offset + size_t(stream.row) * level.width], rows * row_bytes);
+			stream.row += rows;
+			uploads.emplace_back(Upload{texture, stream.level, stream.row - rows, rows, level.width, used, stream.row == level.height});
+			used += rows * row_bytes;
+
+			if (stream.row < level.height) break; //out of space
+			if (stream.level == 0) {
+				//all done; the worker's copy of the pixels isn't needed any more:
+				texture->stream.reset();
+				texture->loaded = true;
+				break;
+			}
+			stream.level -= 1;
+			stream.row = 0;
+		}
+		if (used == capacity) break;
+	}
+
+	if (mapped) {
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		for (Upload const &upload : uploads) {
+			glBindTexture(GL_TEXTURE_2D, upload.texture->texture);
+			glTexSubImage2D(GL_TEXTURE_2D, upload.level, 0, upload.row, upload.width, upload.rows, GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast< void const * >(upload.offset));
+			PerfStats::count_upload(uint64_t(upload.width) * upload.rows * 4);
+			if (upload.finishes_level) {
+				//sample from the finest level that's fully uploaded:
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, upload.level);
+			}
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+	//over budget? evict whatever has gone longest without being drawn (but never anything drawn last frame):
+	uint64_t total = resident_bytes();
+	if (total > budget_bytes) {
+		std::vector< Texture * > candidates;
+		for (Texture *texture : textures) {
+			if (texture->allocated && texture->touched + 1 < update_count) candidates.emplace_back(texture);
+		}
+		std::sort(candidates.begin(), candidates.end(), [](Texture const *a, Texture const *b) {
+			return a->touched < b->touched;
+		});
+		for (Texture *texture : candidates) {
+			if (total <= budget_bytes) break;
+			make_placeholder(*texture, uint32_t(texture->levels.size()));
+			total -= texture->bytes;
+			texture->allocated = false;
+			texture->loaded = false;
+			texture->stream.reset();
+		}
+	}
+
+	GL_ERRORS();
+}
+
+void Texture::shutdown() {
+	{
+		std::lock_guard< std::mutex > lock(jobs_mutex);
+		quit = true;
+		jobs.clear();
+	}
+	jobs_cv.notify_all();
+	if (worker.joinable()) worker.join();
+
+	if (upload_buffer != 0) {
+		glDeleteBuffers(1, &upload_buffer);
+		upload_buffer = 0;
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+/*
+ * A Texture is an OpenGL texture that loads in the background, from either
+ *  a packed texture file (".tex", made by pack-textures from a pile of PNGs)
+ *  or a plain ".png":
+ *
+ * //at global scope:
+ * Load< Texture > tiles(LoadTagDefault, []() -> Texture const * {
+ *     return new Texture(data_path("tiles.tex"));
+ * });
+ *
+ * //later, every frame the texture is drawn:
+ * tiles->touch();
+ * pipeline.textures[0].texture = tiles->texture;
+ * Texture::Region const &grass = tiles->lookup("grass"); //where "grass.png" ended up in the atlas
+ *
+ * 'texture' is a valid texture name from the start; until the pixels arrive
+ *  it samples as opaque white. Files are read (and PNGs decoded) on a
+ *  worker thread; Texture::update() then streams the pixels to the GPU
+ *  through a pixel unpack buffer, at most upload_bytes_per_frame per frame.
+ *  Packed files carry their mip chain and upload smallest level first, so
+ *  a texture sharpens as it streams in. PNGs get the same treatment: the
+ *  worker builds their mip chain on the CPU (make_mipmaps, in mipmaps.hpp)
+ *  and the levels are streamed just like a packed file's.
+ *
+ * The total size of resident textures is kept under budget_bytes by
+ *  dropping the textures that have gone longest without a touch() back to
+ *  the white placeholder. Touching an evicted texture loads it again.
+ *
+ * Packed file format (chunks as per read_chunk):
+ *  "tex0": Level[] -- mip levels, largest first
+ *  "str0": char[] -- region names
+ *  "reg0": RegionEntry[] -- named rectangles (in level-0 pixels)
+ *  "rgba": glm::u8vec4[] -- pixels of every level, bottom row first
+ *
+ */
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct Texture {
+	//construct from a file:
+	// note: throws if a packed file's header is bad; pixel errors are reported when update() finds them
+	Texture(std::string const &filename);
+	~Texture();
+	Texture(Texture const &) = delete;
+	Texture &operator=(Texture const &) = delete;
+
+	//the OpenGL texture (always valid; see above):
+	GLuint texture = 0;
+
+	//named rectangles from a packed file, in texture coordinates:
+	struct Region {
+		glm::vec2 min = glm::vec2(0.0f);
+		glm::vec2 max = glm::vec2(1.0f);
+	};
+	//look up a region by name:
+	// note: will throw if region not found.
+	Region const &lookup(std::string const &name) const;
+
+	//mark as in use this frame (keeps it resident, or brings it back if evicted):
+	void touch() const;
+
+	//are all of the pixels on the GPU?
+	bool resident() const;
+
+	//------ streaming ------
+
+	//call once per frame from the GL thread:
+	// (hands out finished decodes, uploads up to upload_bytes_per_frame, and enforces budget_bytes)
+	static void update();
+
+	//stop the worker thread (call before destroying the GL context):
+	static void shutdown();
+
+	static uint64_t upload_bytes_per_frame; //default: 8MB
+	static uint64_t budget_bytes; //default: 256MB
+	static uint64_t resident_bytes(); //current total
+
+	//-- internals ---
+	std::string filename;
+	std::map< std::string, Region > regions;
+
+	struct Level {
+		uint32_t width, height;
+		uint32_t offset; //first pixel of this level in the "rgba" chunk
+	};
+	static_assert(sizeof(Level) == 12, "Level is packed.");
+
+	struct RegionEntry {
+		uint32_t name_begin, name_end;
+		uint32_t x, y, width, height;
+	};
+	static_assert(sizeof(RegionEntry) == 24, "RegionEntry is packed.");
+
+	struct Stream; //loading/upload state
+	std::shared_ptr< Stream > stream;
+	std::vector< Level > levels; //from a packed file's header, or filled in once a PNG is decoded
+	uint64_t pixels_offset = 0; //where the "rgba" chunk starts in a packed file
+	uint64_t bytes = 0; //GPU memory used once fully resident (0 if not known yet)
+	bool allocated = false; //levels specified (so 'bytes' are in use on the GPU)
+	bool loaded = false; //all levels uploaded
+	mutable uint64_t touched = 0; //update() count at last touch()
+};
@@ -0,0 +1,62 @@
+#include "UpscaleProgram.hpp"
+
+#include "gl_compile_program.hpp"
+#include "gl_errors.hpp"
+
+Load< UpscaleProgram > upscale_program(LoadTagEarly);
+
+UpscaleProgram::UpscaleProgram() {
+	program = gl_compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform vec2 TEX_SCALE;\n"
+		"out vec2 texCoord;\n"
+		"void main() {\n"
+		//one triangle that covers the viewport:
+		"	vec2 corner = vec2((gl_VertexID & 1) * 2, (gl_VertexID & 2));\n"
+		"	gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);\n"
+		"	texCoord = corner * TEX_SCALE;\n"
+		"}\n"
+	,
+		//fragment shader:
+		"#version 330\n"
+		"uniform sampler2D TEX;\n"
+		"uniform vec2 TEX_SCALE;\n"
+		"uniform vec2 TEXEL;\n"
+		"uniform float SHARPEN;\n"
+		"in vec2 texCoord;\n"
+		"out vec4 fragColor;\n"
+		//stay inside the rendered area (the rest of the texture is stale):
+		"vec4 fetch(vec2 at) {\n"
+		"	return texture(TEX, clamp(at, 0.5 * TEXEL, TEX_SCALE - 0.5 * TEXEL));\n"
+		"}\n"
+		"void main() {\n"
+		"	vec4 center = fetch(texCoord);\n"
+		//unsharp mask against the four neighbors (clamped to their range, so edges don't ring):
+		"	vec3 n = fetch(texCoord + vec2( 0.0, TEXEL.y)).rgb;\n"
+		"	vec3 s = fetch(texCoord + vec2( 0.0,-TEXEL.y)).rgb;\n"
+		"	vec3 e = fetch(texCoord + vec2( TEXEL.x, 0.0)).rgb;\n"
+		"	vec3 w = fetch(texCoord + vec2(-TEXEL.x, 0.0)).rgb;\n"
+		"	vec3 lo = min(center.rgb, min(min(n, s), min(e, w)));\n"
+		"	vec3 hi = max(center.rgb, max(max(n, s), max(e, w)));\n"
+		"	vec3 sharpened = center.rgb + SHARPEN * (4.0 * center.rgb - (n + s + e + w));\n"
+		"	fragColor = vec4(clamp(sharpened, lo, hi), center.a);\n"
+		"}\n"
+	);
+
+	//look up the locations of uniforms:
+	TEX_SCALE_vec2 = glGetUniformLocation(program, "TEX_SCALE");
+	TEXEL_vec2 = glGetUniformLocation(program, "TEXEL");
+	SHARPEN_float = glGetUniformLocation(program, "SHARPEN");
+	GLuint TEX_sampler2D = glGetUniformLocation(program, "TEX");
+
+	//set TEX to always refer to texture binding zero:
+	glUseProgram(program);
+	glUniform1i(TEX_sampler2D, 0);
+	glUseProgram(0);
+}
+
+UpscaleProgram::~UpscaleProgram() {
+	glDeleteProgram(program);
+	program = 0;
+}
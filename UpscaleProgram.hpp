@@ -0,0 +1,23 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Load.hpp"
+
+//Shader program that stretches part of a texture over the whole viewport, with a little sharpening:
+// (used by DynamicResolution; draws a full-screen triangle from gl_VertexID, so needs no attributes)
+struct UpscaleProgram {
+	UpscaleProgram();
+	~UpscaleProgram();
+
+	GLuint program = 0;
+	//Attribute (per-vertex variable) locations:
+	// none
+	//Uniform (per-invocation variable) locations:
+	GLuint TEX_SCALE_vec2 = -1U; //texture coordinates of the upper right corner of the rendered area
+	GLuint TEXEL_vec2 = -1U; //size of one texel in texture coordinates
+	GLuint SHARPEN_float = -1U; //0 = plain bilinear
+	//Textures:
+	//TEXTURE0 - image to upscale
+};
+
+extern Load< UpscaleProgram > upscale_program;
@@ -0,0 +1,444 @@
+#include "World.hpp"
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//medal can appear at any of these spots (never the same one twice in a row):
+static std::array< glm::vec3, 6 > const medal_spawn_positions = {
+	glm::vec3(0, 4, 1.4f), glm::vec3(0, -4, 1.4f),
+	glm::vec3(-16, -12, 9.4f), glm::vec3(-16, -8, 17.4f),
+	glm::vec3(8, -16, 1.4f), glm::vec3(24, 20, 1.4f)
+};
+
+World::World(uint32_t seed) : rng(seed) {
+	//------ player + medal ------
+	player.body.position = glm::vec3(-2.0f, -2.0f, 2.0f);
+	player.shadow_height = -2.0f;
+
+	medal.body.position = glm::vec3(0.0f, 0.0f, 1.4f);
+
+	ground.position = glm::vec3(0.0f, 0.0f, -1.0f);
+
+	//------ buildings (see og design doc for reference) ------
+	buildings[0].body.position = glm::vec3(-12.0f, -12.0f, 4.0f); //bottom right
+	buildings[1].body.position = glm::vec3(-20.0f, -12.0f, 4.0f); //bottom left
+	buildings[2].body.position = glm::vec3(-28.0f, 8.0f, 4.0f); //middle left down
+	buildings[3].body.position = glm::vec3(-28.0f, 12.0f, 4.0f); //middle left up
+	buildings[4].body.position = glm::vec3(-12.0f, 20.0f, 4.0f); //top right (ground floor)
+	buildings[5].body.position = glm::vec3(-12.0f, 20.0f, 12.0f); //top right (upper floor)
+
+	//------ trees ------
+	trees[0].body.position = glm::vec3(12.0f, 20.0f, 4.5f);
+	trees[1].body.position = glm::vec3(20.0f, -20.0f, 4.5f);
+	trees[2].body.position = glm::vec3(8.0f, -8.0f, 4.5f);
+
+	//------ springs ------
+	//city:
+	springs[0].body.position = glm::vec3(-12.0f, -20.0f, -0.5f); //bottom right
+	springs[1].body.position = glm::vec3(-20.0f, -12.0f, 7.5f); //bottom left
+	springs[2].body.position = glm::vec3(-26.0f, 12.0f, 7.5f); //middle left
+	springs[3].body.position = glm::vec3(-12.0f, 18.0f, 15.5f); //middle right
+	springs[4].body.position = glm::vec3(-20.0f, 28.0f, -0.5f); //top
+	//forest:
+	springs[5].body.position = glm::vec3(12.0f, -20.0f, -0.5f); //bottom
+	springs[6].body.position = glm::vec3(20.0f, 4.0f, -0.5f); //right
+
+	//------ static colliders ------
+	static std::shared_ptr< StaticColliders const > const shared = [this](){
+		auto ret = std::make_shared< StaticColliders >();
+		auto add_group = [&ret](std::vector< Collider > const &group) {
+			StaticColliders::Group g;
+			g.min = glm::vec3( std::numeric_limits< float >::infinity());
+			g.max = glm::vec3(-std::numeric_limits< float >::infinity());
+			g.begin = uint32_t(ret->colliders.size());
+			for (Collider const &c : group) {
+				g.min = glm::min(g.min, c.center - glm::vec3(c.radius));
+				g.max = glm::max(g.max, c.center + glm::vec3(c.radius));
+				ret->colliders.emplace_back(c);
+			}
+			g.end = uint32_t(ret->colliders.size());
+			ret->groups.emplace_back(g);
+		};
+
+		std::vector< Collider > group;
+		for (uint32_t b = 0; b < buildings.size(); ++b) {
+			constexpr uint32_t N = Building::SPHERES_PER_SIDE;
+			group.clear();
+			for (uint32_t z = 0; z < N; ++z) {
+				for (uint32_t y = 0; y < N; ++y) {
+					for (uint32_t x = 0; x < N; ++x) {
+						glm::vec3 offset = glm::vec3(x, y, z) - glm::vec3(0.5f * (N - 1));
+						group.emplace_back(Collider{buildings[b].body.position + offset, Building::SPHERE_RADIUS, Tag::Building, b});
+					}
+				}
+			}
+			add_group(group);
+		}
+		for (uint32_t t = 0; t < trees.size(); ++t) {
+			group.clear();
+			for (float height : Tree::COLLIDER_HEIGHTS) {
+				group.emplace_back(Collider{trees[t].body.position + glm::vec3(0.0f, 0.0f, height), Tree::COLLIDER_RADIUS, Tag::Tree, t});
+			}
+			add_group(group);
+		}
+		for (uint32_t s = 0; s < springs.size(); ++s) {
+			add_group({ Collider{springs[s].body.position, Spring::COLLIDER_RADIUS, Tag::Spring, s} });
+		}
+		return ret;
+	}();
+	static_colliders = shared;
+}
+
+//------------------------------------------------
+// Player
+
+float World::Player::lateral_speed() const {
+	return std::sqrt((velocity.x * velocity.x) + (velocity.y * velocity.y));
+}
+
+void World::Player::turn(float direction, float t) {
+	float turn_mod = chargeTimer <= 0 ? 0.5f + (0.5f * (lateral_speed() / TOP_BASE_SPEED_LATERAL)) : 0.5f;
+	float angle_delta = TURN_SPEED * direction * -1 * turn_mod * t;
+	body.rotation = glm::rotate(body.rotation, angle_delta, glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+void World::Player::accelerate(float t) {
+	velocity += (gravity + (body.forward() * (!airborne ? GROUND_ACCEL : AIR_ACCEL))) * t;
+	accelerating = true;
+}
+
+bool World::Player::jump() {
+	if (airborne) return false;
+
+	velocity.z += JUMP_STRENGTH;
+	airborne = true;
+	jumping = true;
+	return true;
+}
+
+void World::Player::charge_brake(float t) {
+	boostTimer = 0;
+
+	//slow down and charge:
+	glm::vec2 lateral = glm::vec2(velocity.x, velocity.y);
+	if (lateral != glm::vec2(0.0f)) {
+		glm::vec2 lateral_dir = glm::normalize(lateral);
+		velocity.x -= lateral_dir.x * FRICTION_DECEL;
+		velocity.y -= lateral_dir.y * FRICTION_DECEL;
+	}
+	if (chargeTimer < CHARGE_TIME)
+		chargeTimer += t;
+}
+
+bool World::Player::boost() {
+	if (chargeTimer >= CHARGE_TIME) {
+		//set velocity in forward direction, including jump if airborne:
+		velocity = body.forward() * TOP_BASE_SPEED_LATERAL * BOOST_POWER;
+		chargeTimer = 0;
+		boostTimer = 2;
+		return true;
+	}
+	chargeTimer = 0;
+	return false;
+}
+
+bool World::Player::spring_jump(uint32_t spring, float strength) {
+	if (spring == lastSpring) return false;
+	velocity.z += strength;
+	airborne = true;
+	lastSpring = spring;
+	jumping = true;
+	return true;
+}
+
+//------------------------------------------------
+// World
+
+void World::update(float elapsed, Controls const &controls) {
+	PROFILE_ZONE("World::update");
+
+	//meteor spawner:
+	if (meteors_enabled) {
+		if (meteorSpawnTimer <= 0) {
+			std::uniform_real_distribution< float > spot(-30.0f, 32.0f);
+			meteors.emplace_back();
+			Meteor &meteor = meteors.back();
+			meteor.body.position.x = spot(rng);
+			meteor.body.position.y = spot(rng);
+			meteor.body.position.z = METEOR_SPAWN_HEIGHT;
+			meteorSpawnTimer += METEOR_SPAWN_TIME;
+		}
+		meteorSpawnTimer -= elapsed;
+	}
+
+	//player controls:
+	if (controls.jump) player.jump();
+	if (controls.brake) player.charge_brake(elapsed);
+	if (controls.left && !controls.right) player.turn(-1, elapsed);
+	if (!controls.left && controls.right) player.turn(1, elapsed);
+	if (controls.accelerate && !controls.brake) player.accelerate(elapsed);
+
+	//entity updates:
+	update_player(elapsed);
+	update_medal(elapsed);
+	update_springs(elapsed);
+	update_meteors(elapsed);
+	update_flames(elapsed);
+
+	time += elapsed;
+}
+
+void World::update_player(float t) {
+	PROFILE_ZONE("World::update_player");
+
+	Player &p = player;
+
+	//------ physics ------
+	{
+		glm::vec2 lateral = glm::vec2(p.velocity.x, p.velocity.y);
+
+		//decelerate (on the ground, when not accelerating or boosting):
+		if (!p.accelerating && p.boostTimer <= 0 && !p.airborne && lateral != glm::vec2(0.0f)) {
+			glm::vec2 lateral_dir = glm::normalize(lateral);
+			p.velocity.x -= lateral_dir.x * p.FRICTION_DECEL;
+			p.velocity.y -= lateral_dir.y * p.FRICTION_DECEL;
+			lateral = glm::vec2(p.velocity.x, p.velocity.y);
+		}
+
+		//clamp lateral speed:
+		if (lateral != glm::vec2(0.0f)) {
+			glm::vec2 lateral_dir = glm::normalize(lateral);
+			float maxLatSpeed = p.TOP_BASE_SPEED_LATERAL * (p.boostTimer <= 0 ? 1 : p.BOOST_POWER);
+			float finalLatSpeed = p.lateral_speed();
+			if (finalLatSpeed > maxLatSpeed) { //bring it down to top speed if exceeding it
+				float speedDecay = (!p.airborne ? p.FRICTION_DECEL : p.AIR_ACCEL) * 4 * t;
+				finalLatSpeed = std::max(maxLatSpeed, finalLatSpeed - speedDecay);
+			}
+			p.velocity.x = lateral_dir.x * finalLatSpeed;
+			p.velocity.y = lateral_dir.y * finalLatSpeed;
+		}
+
+		//apply gravity:
+		p.velocity += p.gravity * t;
+
+		p.body.position += p.velocity * t;
+	}
+
+	float highestLanding = GROUND_LEVEL;
+
+	//------ collisions ------
+	{
+		PROFILE_ZONE("World player collisions");
+
+		//player->medal:
+		{
+			Collider other = medal.collider();
+			for (uint32_t i = 0; i < Player::COLLIDERS; ++i) {
+				if (test(p.collider(i), other)) {
+					p.multiplier += p.MULTIPLIER_GAIN;
+					p.comboTimer = p.COMBO_DURATION;
+				}
+			}
+		}
+
+		//player->spring (launch), player->building + player->tree (push out; may land on top):
+		for (StaticColliders::Group const &group : static_colliders->groups) {
+			//quick rejection -- groups entirely out of reach of the player (and not under it) are skipped:
+			constexpr float Reach = 0.5f * 1.41421356f + Player::COLLIDER_RADIUS; //player spheres are all within this distance of body.position
+			glm::vec3 const &at = p.body.position;
+			if (at.x + Reach < group.min.x || at.x - Reach > group.max.x || at.y + Reach < group.min.y || at.y - Reach > group.max.y) continue;
+			bool in_reach = !(at.z + Reach < group.min.z || at.z - Reach > group.max.z);
+
+			for (uint32_t c = group.begin; c < group.end; ++c) {
+				Collider const &other = static_colliders->colliders[c];
+				if (other.tag == Tag::Spring) {
+					for (uint32_t i = 0; i < Player::COLLIDERS && in_reach; ++i) {
+						if (test(p.collider(i), other)) {
+							p.spring_jump(other.owner, p.SPRING_STRENGTH);
+							break;
+						}
+					}
+					continue;
+				}
+
+				for (uint32_t i = 0; i < Player::COLLIDERS && in_reach; ++i) {
+					Collider mine = p.collider(i);
+					if (test(mine, other)) {
+						glm::vec3 motion = other.center - mine.center;
+						float pushback = mine.radius + other.radius - glm::length(motion);
+						p.body.position -= glm::normalize(motion) * pushback;
+
+						if (p.body.position.z > other.center.z + other.radius) {
+							p.airborne = true;
+							p.lastSpring = -1U;
+						}
+					}
+				}
+
+				//track the highest thing under the player (for the drop shadow):
+				glm::vec2 lateral_away = glm::vec2(other.center.x - p.body.position.x, other.center.y - p.body.position.y);
+				if (glm::dot(lateral_away, lateral_away) < other.radius * other.radius) {
+					highestLanding = std::max(highestLanding, other.center.z + other.radius);
+				}
+			}
+		}
+
+		//player->meteor:
+		for (uint32_t m = 0; m < meteors.size(); ++m) {
+			Collider other = meteors[m].collider(m);
+			for (uint32_t i = 0; i < Player::COLLIDERS; ++i) {
+				if (test(p.collider(i), other)) {
+					p.health -= p.METEOR_DAMAGE;
+					break;
+				}
+			}
+		}
+
+		//player->flame:
+		for (uint32_t f = 0; f < flames.size(); ++f) {
+			Collider other = flames[f].collider(f);
+			for (uint32_t i = 0; i < Player::COLLIDERS; ++i) {
+				if (test(p.collider(i), other)) {
+					p.health -= p.FLAME_DPS * t;
+					break;
+				}
+			}
+		}
+	}
+
+	//------ game logic ------
+	p.accelerating = false;
+	if (p.boostTimer > 0) p.boostTimer = std::clamp(p.boostTimer - t, 0.0f, p.BOOST_TIME);
+	if (p.comboTimer > 0) p.comboTimer = std::clamp(p.comboTimer - t, 0.0f, p.COMBO_DURATION);
+	p.score += p.lateral_speed() * t * p.SCORE_GAIN * p.multiplier;
+
+	//land on the arena floor (or fall off the edge of it):
+	if (!p.jumping && p.body.position.z <= GROUND_LEVEL + 1) {
+		if (std::abs(p.body.position.x) <= ARENA_HALF_SIZE && std::abs(p.body.position.y) <= ARENA_HALF_SIZE) {
+			p.body.position.z = GROUND_LEVEL + 1;
+			p.velocity.z = 0.0f;
+			p.airborne = false;
+			p.lastSpring = -1U;
+		} else {
+			p.airborne = true;
+			if (p.body.position.z < -20) {
+				fell_off = true;
+			}
+		}
+	}
+	p.jumping = false;
+
+	p.shadow_height = highestLanding;
+}
+
+void World::update_medal(float t) {
+	//move somewhere else when the player touches the medal:
+	for (uint32_t i = 0; i < Player::COLLIDERS; ++i) {
+		if (test(medal.collider(), player.collider(i))) {
+			std::uniform_int_distribution< uint32_t > other_index(0, uint32_t(medal_spawn_positions.size()) - 2);
+			uint32_t index = other_index(rng);
+			if (index >= medal.spawn_index) index += 1; //skip over the current spot
+			medal.spawn_index = index;
+			medal.body.position = medal_spawn_positions[index];
+		}
+	}
+
+	//spin:
+	medal.body.rotation = glm::rotate(medal.body.rotation, medal.ROTATE_SPEED * t, glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+void World::update_springs(float t) {
+	for (Spring &spring : springs) {
+		if (spring.state == Spring::Resting) {
+			Collider collider{spring.body.position, Spring::COLLIDER_RADIUS, Tag::Spring, 0};
+			for (uint32_t i = 0; i < Player::COLLIDERS; ++i) {
+				if (test(collider, player.collider(i))) {
+					spring.shootTimer = spring.SHOOT_TIME;
+					spring.state = Spring::Shooting;
+					break;
+				}
+			}
+		}
+
+		switch (spring.state) {
+			case Spring::Shooting:
+				if (spring.shootTimer <= 0) {
+					spring.state = Spring::Sinking;
+					spring.sinkTimer = spring.SINK_TIME;
+				} else {
+					spring.shootTimer = std::clamp(spring.shootTimer - t, 0.0f, spring.SHOOT_TIME);
+				}
+				break;
+			case Spring::Sinking:
+				if (spring.sinkTimer <= 0) spring.state = Spring::Resting;
+				else spring.sinkTimer = std::clamp(spring.sinkTimer - t, 0.0f, spring.SINK_TIME);
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+void World::update_meteors(float t) {
+	PROFILE_ZONE("World meteor collisions");
+
+	for (uint32_t m = 0; m < meteors.size(); /* later */) {
+		Meteor &meteor = meteors[m];
+		meteor.body.position += meteor.velocity * t;
+
+		//meteor->ground, meteor->building, meteor->tree, meteor->player:
+		bool hit = (meteor.body.position.z <= GROUND_LEVEL + Meteor::COLLIDER_RADIUS);
+		Collider mine = meteor.collider(m);
+		glm::vec3 lo = mine.center - glm::vec3(mine.radius);
+		glm::vec3 hi = mine.center + glm::vec3(mine.radius);
+		for (StaticColliders::Group const &group : static_colliders->groups) {
+			if (hit) break;
+			if (hi.x < group.min.x || lo.x > group.max.x || hi.y < group.min.y || lo.y > group.max.y || hi.z < group.min.z || lo.z > group.max.z) continue;
+			for (uint32_t c = group.begin; c < group.end && !hit; ++c) {
+				Collider const &other = static_colliders->colliders[c];
+				if (other.tag == Tag::Spring) continue;
+				hit = test(mine, other);
+			}
+		}
+		for (uint32_t i = 0; i < Player::COLLIDERS && !hit; ++i) {
+			hit = test(mine, player.collider(i));
+		}
+
+		if (hit) {
+			spawn_flames(meteor.body.position);
+			meteors.erase(meteors.begin() + m);
+		} else {
+			++m;
+		}
+	}
+}
+
+void World::update_flames(float t) {
+	for (uint32_t f = 0; f < flames.size(); /* later */) {
+		Flame &flame = flames[f];
+		flame.burnTimer = std::clamp(flame.burnTimer - t, 0.0f, flame.BURN_DURATION);
+		if (flame.burnTimer <= 0.0f) {
+			flames.erase(flames.begin() + f);
+		} else {
+			++f;
+		}
+	}
+}
+
+void World::spawn_flames(glm::vec3 const &at) {
+	//one flame at the impact, then a line of flames spreading out in each direction:
+	auto add_flame = [&](glm::vec3 const &position) {
+		flames.emplace_back();
+		flames.back().body.position = position;
+		flames.back().burnTimer = flames.back().BURN_DURATION;
+	};
+	add_flame(at);
+	for (glm::vec3 dir : { glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f) }) {
+		for (uint32_t step = 1; step <= FLAME_SPREAD; ++step) {
+			add_flame(at + dir * (float(step) * Flame::COLLIDER_RADIUS));
+		}
+	}
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+/*
+ * World holds the gameplay state for one round of Rubbapocalypse! -- the
+ *  player, the medal, springs, buildings, trees, meteors and their flames --
+ *  along with the rules that step that state forward in time.
+ *
+ * World does not know about OpenGL, SDL, or Scene, so it can be stepped
+ *  without a window (see sim.cpp). PlayMode owns a World and mirrors its
+ *  Bodys into Scene::Transforms for drawing.
+ *
+ * World is a plain value type; copying a World copies the whole round.
+ *
+ */
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+struct World {
+	//start a fresh round; 'seed' drives every random choice the world makes:
+	World(uint32_t seed = 0);
+
+	//the arena floor is at this height; the play area is [-32,32]^2:
+	static constexpr float GROUND_LEVEL = 0.0f;
+	static constexpr float ARENA_HALF_SIZE = 32.0f;
+
+	//------ shared pieces ------
+
+	//where something is (same conventions as Scene::Transform, z is up):
+	struct Body {
+		glm::vec3 position = glm::vec3(0.0f);
+		glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f); //n.b. wxyz init order
+		glm::vec3 scale = glm::vec3(1.0f);
+
+		glm::vec3 forward() const { return rotation * glm::vec3(0.0f, 1.0f, 0.0f); }
+	};
+
+	//Everything collides as a cluster of spheres:
+	// (spheres are much simpler than boxes to test against each other; see
+	//  https://math.stackexchange.com/questions/2651710/simplest-way-to-determine-if-two-3d-boxes-intersect )
+	enum class Tag : uint8_t {
+		Player,
+		Medal,
+		Building,
+		Tree,
+		Spring,
+		Meteor,
+		Flame,
+	};
+
+	struct Collider {
+		glm::vec3 center = glm::vec3(0.0f); //world space
+		float radius = 1.0f;
+		Tag tag = Tag::Building;
+		uint32_t owner = 0; //index of the owning object in its list (e.g., which spring)
+
+		bool test(Collider const &other) const {
+			glm::vec3 to_other = other.center - center;
+			float threshold = radius + other.radius;
+			return glm::dot(to_other, to_other) < threshold * threshold;
+		}
+	};
+
+	//------ inputs ------
+
+	//what the player is holding down during a step:
+	struct Controls {
+		bool left = false; //turn counterclockwise
+		bool right = false; //turn clockwise
+		bool accelerate = false;
+		bool brake = false; //charge a boost
+		bool jump = false;
+	};
+
+	//------ objects ------
+
+	struct Player {
+		Body body;
+		glm::vec3 velocity = glm::vec3(0.0f);
+		glm::vec3 gravity = glm::vec3(0.0f, 0.0f, -9.81f);
+
+		//four collision spheres at (+/-0.5, +/-0.5, 0) from body.position (Tireler has radius 1 and width 1):
+		static constexpr uint32_t COLLIDERS = 4;
+		static constexpr float COLLIDER_RADIUS = 1.0f;
+		Collider collider(uint32_t i) const {
+			glm::vec3 offset = glm::vec3((i & 2 ? 0.5f : -0.5f), (i & 1 ? 0.5f : -0.5f), 0.0f);
+			return Collider{body.position + offset, COLLIDER_RADIUS, Tag::Player, i};
+		}
+
+		//height of whatever is under the player (where the drop shadow goes):
+		float shadow_height = GROUND_LEVEL;
+
+		//game rules:
+		float score = 0;
+		float SCORE_GAIN = 100; // 100 points per second of driving
+		float multiplier = 1;
+		float MULTIPLIER_GAIN = 1; // adds this to multiplier every time a medal is collected
+		float MAX_MULTIPLIER = 8;
+		float COMBO_DURATION = 10; // if you don't collect a new medal in this time, the multiplier resets
+		float comboTimer = 0;
+
+		//hazards:
+		float FLAME_DPS = 13.0f;
+		float METEOR_DAMAGE = 20.0f;
+
+		//state (timers are also used as state):
+		float health = 100;
+		bool accelerating = false;
+		bool airborne = false;
+		bool jumping = false;
+
+		//basic movement:
+		float TURN_SPEED = 3.14159265358979f; // radians per second. Scales with current lateral speed
+		float TOP_BASE_SPEED_LATERAL = 10; // units per second
+		float GROUND_ACCEL = 20; // units per second^2, applied while accelerating
+		float AIR_ACCEL = 1; // units per second^2, applied while accelerating
+		float FRICTION_DECEL = 5; // applied on the ground while not accelerating
+		float JUMP_STRENGTH = 10; // initial jump speed, units per second
+
+		//brake boost:
+		float BRAKE_DECEL = 8;
+		float CHARGE_TIME = 1;
+		float chargeTimer = 0;
+		float BOOST_POWER = 1.5f; // multiplies TOP_BASE_SPEED while boosting
+		float BOOST_TIME = 2;
+		float boostTimer = 0;
+
+		//springs:
+		float SPRING_STRENGTH = 20.0f; // units per second
+		uint32_t lastSpring = -1U; // index of the spring that launched us (-1U for none)
+
+		float lateral_speed() const;
+
+		void turn(float direction, float t);
+		void accelerate(float t);
+		bool jump();
+		void charge_brake(float t);
+		bool boost();
+		bool spring_jump(uint32_t spring, float strength);
+	} player;
+
+	struct Medal {
+		Body body;
+		static constexpr float COLLIDER_RADIUS = 0.9f;
+		Collider collider() const { return Collider{body.position, COLLIDER_RADIUS, Tag::Medal, 0}; }
+
+		uint32_t spawn_index = 0; //index into the list of medal spawn points
+		float ROTATE_SPEED = 3.14159265358979f / 4; // radians per second
+	} medal;
+
+	struct Spring {
+		Body body;
+		static constexpr float COLLIDER_RADIUS = 2.0f;
+
+		enum State : uint8_t {
+			Resting,
+			Shooting,
+			Sinking
+		} state = Resting;
+		float SHOOT_TIME = 0.1f;
+		float SINK_TIME = 0.9f;
+		float shootTimer = 0.0f;
+		float sinkTimer = 0.0f;
+	};
+	std::array< Spring, 7 > springs;
+
+	//buildings are 8x8x8 blocks, collided as 512 unit-diameter spheres:
+	struct Building {
+		Body body;
+		static constexpr uint32_t SPHERES_PER_SIDE = 8;
+		static constexpr float SPHERE_RADIUS = 0.5f;
+	};
+	std::array< Building, 6 > buildings;
+
+	struct Tree {
+		Body body;
+		static constexpr std::array< float, 3 > COLLIDER_HEIGHTS = { -3.0f, 0.0f, 3.0f };
+		static constexpr float COLLIDER_RADIUS = 1.5f;
+	};
+	std::array< Tree, 3 > trees;
+
+	Body ground; //no collider: uses GROUND_LEVEL
+
+	struct Meteor {
+		Body body;
+		glm::vec3 velocity = glm::vec3(0.0f, 0.0f, -20.0f);
+		static constexpr float COLLIDER_RADIUS = 1.8f;
+		Collider collider(uint32_t index) const { return Collider{body.position, COLLIDER_RADIUS, Tag::Meteor, index}; }
+	};
+	std::vector< Meteor > meteors;
+
+	struct Flame {
+		Body body;
+		static constexpr float COLLIDER_RADIUS = 1.0f;
+		Collider collider(uint32_t index) const { return Collider{body.position, COLLIDER_RADIUS, Tag::Flame, index}; }
+		float BURN_DURATION = 3.0f;
+		float burnTimer = 0.0f;
+	};
+	std::vector< Flame > flames;
+
+	//meteor showers (still being tuned, so off by default):
+	bool meteors_enabled = false;
+	float METEOR_SPAWN_TIME = 30;
+	float METEOR_SPAWN_HEIGHT = 30;
+	float meteorSpawnTimer = 0;
+	uint32_t FLAME_SPREAD = 8; //flames spread this many steps in each direction from an impact
+
+	//colliders that never move (buildings, trees, springs):
+	// (these are placed identically in every World, so all Worlds share one copy)
+	struct StaticColliders {
+		std::vector< Collider > colliders;
+		//colliders are grouped by owning object; each group has bounds around all of its spheres for quick rejection:
+		struct Group {
+			glm::vec3 min = glm::vec3(0.0f);
+			glm::vec3 max = glm::vec3(0.0f);
+			uint32_t begin = 0; //range in 'colliders'
+			uint32_t end = 0;
+		};
+		std::vector< Group > groups;
+	};
+	std::shared_ptr< StaticColliders const > static_colliders;
+
+	//random number generator for all of the world's random choices:
+	// (small-state generator so that many Worlds can be kept in memory at once)
+	std::minstd_rand rng;
+
+	//------ stepping ------
+
+	//advance the world by 'elapsed' seconds, with 'controls' held:
+	void update(float elapsed, Controls const &controls);
+
+	//total time stepped so far:
+	float time = 0.0f;
+
+	//set by update() once the player has fallen out of the arena (the round is over):
+	bool fell_off = false;
+
+	//number of collider pair tests done by update() so far (for performance stats):
+	uint64_t collider_tests = 0;
+
+	//-- internals ---
+	bool test(Collider const &a, Collider const &b) { collider_tests += 1; return a.test(b); }
+	void update_player(float elapsed);
+	void update_medal(float elapsed);
+	void update_springs(float elapsed);
+	void update_meteors(float elapsed);
+	void update_flames(float elapsed);
+	void spawn_flames(glm::vec3 const &at);
+};
@@ -1,10 +1,156 @@
 #include "gl_compile_program.hpp"
 
+#include "data_path.hpp"
+#include "read_write_chunk.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <vector>
 #include <string>
 #include <stdexcept>
 #include <iostream>
 
+//------ program binary cache ------
+
+bool gl_program_cache = true;
+
+//program binaries are core in OpenGL 4.1, not 3.3, so GL.hpp doesn't have them;
+// look them up from ARB_get_program_binary instead:
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+
+typedef void (APIENTRY *PFN_glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary);
+typedef void (APIENTRY *PFN_glProgramBinary)(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length);
+typedef void (APIENTRY *PFN_glProgramParameteri)(GLuint program, GLenum pname, GLint value);
+
+static struct {
+	bool initialized = false;
+	bool available = false;
+	PFN_glGetProgramBinary GetProgramBinary = nullptr;
+	PFN_glProgramBinary ProgramBinary = nullptr;
+	PFN_glProgramParameteri ProgramParameteri = nullptr;
+	std::string driver; //vendor, renderer, and version strings (part of every key)
+	std::string dir;
+} cache;
+
+static bool cache_available() {
+	if (cache.initialized) return cache.available;
+	cache.initialized = true;
+	if (!gl_program_cache) return false;
+
+	if (!SDL_GL_ExtensionSupported("GL_ARB_get_program_binary")) return false;
+	cache.GetProgramBinary = (PFN_glGetProgramBinary)SDL_GL_GetProcAddress("glGetProgramBinary");
+	cache.ProgramBinary = (PFN_glProgramBinary)SDL_GL_GetProcAddress("glProgramBinary");
+	cache.ProgramParameteri = (PFN_glProgramParameteri)SDL_GL_GetProcAddress("glProgramParameteri");
+	if (!cache.GetProgramBinary || !cache.ProgramBinary || !cache.ProgramParameteri) return false;
+
+	//some drivers advertise the extension but support no formats:
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	if (formats <= 0) return false;
+
+	for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION}) {
+		GLubyte const *str = glGetString(name);
+		if (str) cache.driver += reinterpret_cast< char const * >(str);
+		cache.driver += '\n';
+	}
+
+	cache.dir = data_path("shader-cache/");
+	std::error_code ec;
+	std::filesystem::create_directories(cache.dir, ec);
+	if (ec) {
+		std::cerr << "WARNING: not caching shader programs; can't create '" << cache.dir << "': " << ec.message() << std::endl;
+		return false;
+	}
+
+	cache.available = true;
+	return true;
+}
+
+//everything that must match for a binary to be reused:
+static std::string cache_key(std::string const &vertex_shader_source, std::string const &fragment_shader_source) {
+	std::string key = cache.driver;
+	key += vertex_shader_source;
+	key += '\0';
+	key += fragment_shader_source;
+	return key;
+}
+
+static std::string cache_filename(std::string const &key) {
+	//64-bit FNV-1a:
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (char c : key) {
+		hash = (hash ^ uint8_t(c)) * 0x100000001b3ULL;
+	}
+	char name[32];
+	std::snprintf(name, sizeof(name), "%016llx.glprog", (unsigned long long)hash);
+	return cache.dir + name;
+}
+
+//cache file format (chunks as per read_chunk):
+// "key0": char[] -- the whole key (so hash collisions are caught)
+// "fmt0": uint32_t[1] -- binary format
+// "bin0": uint8_t[] -- glGetProgramBinary's output
+
+//returns a linked program, or 0 if there isn't a usable cached binary:
+static GLuint load_cached_program(std::string const &key, std::string const &filename) {
+	std::ifstream file(filename, std::ios::binary);
+	if (!file) return 0; //(not cached yet)
+
+	std::vector< char > stored_key;
+	std::vector< uint32_t > format;
+	std::vector< uint8_t > binary;
+	try {
+		read_chunk(file, "key0", &stored_key);
+		read_chunk(file, "fmt0", &format);
+		read_chunk(file, "bin0", &binary);
+	} catch (std::exception &e) {
+		std::cerr << "WARNING: ignoring damaged shader cache file '" << filename << "': " << e.what() << std::endl;
+		return 0;
+	}
+	if (format.size() != 1 || std::string(stored_key.begin(), stored_key.end()) != key) return 0;
+
+	GLuint program = glCreateProgram();
+	cache.ProgramBinary(program, GLenum(format[0]), binary.data(), GLsizei(binary.size()));
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	if (link_status != GL_TRUE) {
+		//(drivers may reject binaries they made, e.g. after an update that didn't change the version string)
+		glDeleteProgram(program);
+		while (glGetError() != GL_NO_ERROR) { } //(a rejected binary may also set an error)
+		return 0;
+	}
+	return program;
+}
+
+static void save_cached_program(GLuint program, std::string const &key, std::string const &filename) {
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+
+	std::vector< uint8_t > binary(length);
+	GLenum format = 0;
+	GLsizei written = 0;
+	cache.GetProgramBinary(program, length, &written, &format, binary.data());
+	if (written <= 0) return;
+	binary.resize(written);
+
+	std::ofstream file(filename, std::ios::binary);
+	write_chunk("key0", std::vector< char >(key.begin(), key.end()), &file);
+	write_chunk("fmt0", std::vector< uint32_t >{uint32_t(format)}, &file);
+	write_chunk("bin0", binary, &file);
+	if (!file) {
+		std::cerr << "WARNING: failed to write shader cache file '" << filename << "'." << std::endl;
+	}
+}
+
+//------ compiling ------
+
+
 static GLuint gl_compile_shader(GLenum type, std::string const &source) {
 	GLuint shader = glCreateShader(type);
 	GLchar const *str = source.c_str();
@@ -32,6 +178,14 @@ GLuint gl_compile_program(
 	std::string const &fragment_shader_source
 	) {
 
+	bool cached = cache_available();
+	std::string key, filename;
+	if (cached) {
+		key = cache_key(vertex_shader_source, fragment_shader_source);
+		filename = cache_filename(key);
+		if (GLuint program = load_cached_program(key, filename)) return program;
+	}
+
 	GLuint vertex_shader = gl_compile_shader(GL_VERTEX_SHADER, vertex_shader_source);
 	GLuint fragment_shader = gl_compile_shader(GL_FRAGMENT_SHADER, fragment_shader_source);
 
@@ -43,6 +197,9 @@ GLuint gl_compile_program(
 	glDeleteShader(vertex_shader);
 	glDeleteShader(fragment_shader);
 
+	//ask the driver to keep the binary around for the cache:
+	if (cached) cache.ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 	//link the shader program and throw errors if linking fails:
 	glLinkProgram(program);
 	GLint link_status = GL_FALSE;
@@ -58,5 +215,7 @@ GLuint gl_compile_program(
 		throw std::runtime_error("failed to link program");
 	}
 
+	if (cached) save_cached_program(program, key, filename);
+
 	return program;
 }
@@ -6,6 +6,15 @@
 
 //compiles+links an OpenGL shader program from source.
 // throws on compilation error.
+//
+//Linked programs are also kept in an on-disk cache (data_path("shader-cache/")),
+// keyed by the sources and the driver's vendor, renderer, and version strings;
+// later launches load the driver's binary instead of compiling, and quietly
+// fall back to compiling if the driver rejects it (e.g., after an update).
+// (needs ARB_get_program_binary, which most drivers have; otherwise every program is compiled)
 GLuint gl_compile_program(
 	std::string const &vertex_shader_source,
 	std::string const &fragment_shader_source);
+
+//set to false (before any programs are loaded) to always compile from source:
+extern bool gl_program_cache;
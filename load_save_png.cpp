@@ -1,97 +1,126 @@
 #include "load_save_png.hpp"
 
+#include "Profiler.hpp"
+
 #include <png.h>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <cassert>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PNG_ROWS_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PNG_ROWS_NEON
+#endif
+
 #define LOG_ERROR( X ) std::cerr << X << std::endl
 
 using std::vector;
 
-bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vector< glm::u8vec4 > *data, OriginLocation origin);
-void save_png(std::ostream &to, unsigned int width, unsigned int height, glm::u8vec4 const *data, OriginLocation origin);
-
-void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
-	assert(size);
-
-	std::ifstream file(filename.c_str(), std::ios::binary);
-	if (!file) {
-		throw std::runtime_error("Failed to open PNG image file '" + filename + "'.");
-	}
-	if (!load_png(file, &size->x, &size->y, data, origin)) {
-		throw std::runtime_error("Failed to read PNG image from '" + filename + "'.");
-	}
-}
-
-void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin) {
-	std::ofstream file(filename.c_str(), std::ios::binary);
-	save_png(file, size.x, size.y, data, origin);
-}
-
+//libpng reads and writes through the file's stream buffer directly (skipping istream/ostream's per-call overhead):
 
 static void user_read_data(png_structp png_ptr, png_bytep data, png_size_t length) {
-	std::istream *from = reinterpret_cast< std::istream * >(png_get_io_ptr(png_ptr));
+	std::streambuf *from = reinterpret_cast< std::streambuf * >(png_get_io_ptr(png_ptr));
 	assert(from);
-	if (!from->read(reinterpret_cast< char * >(data), length)) {
+	if (from->sgetn(reinterpret_cast< char * >(data), length) != std::streamsize(length)) {
 		png_error(png_ptr, "Error reading.");
 	}
 }
 
 static void user_write_data(png_structp png_ptr, png_bytep data, png_size_t length) {
-	std::ostream *to = reinterpret_cast< std::ostream * >(png_get_io_ptr(png_ptr));
+	std::streambuf *to = reinterpret_cast< std::streambuf * >(png_get_io_ptr(png_ptr));
 	assert(to);
-	if (!to->write(reinterpret_cast< char * >(data), length)) {
+	if (to->sputn(reinterpret_cast< char const * >(data), length) != std::streamsize(length)) {
 		png_error(png_ptr, "Error writing.");
 	}
 }
 
 static void user_flush_data(png_structp png_ptr) {
-	std::ostream *to = reinterpret_cast< std::ostream * >(png_get_io_ptr(png_ptr));
+	std::streambuf *to = reinterpret_cast< std::streambuf * >(png_get_io_ptr(png_ptr));
 	assert(to);
-	if (!to->flush()) {
+	if (to->pubsync() != 0) {
 		png_error(png_ptr, "Error flushing.");
 	}
 }
 
+//copy 'count' pixels, setting alpha to 0xff on the way:
+static void copy_opaque(glm::u8vec4 *dst, glm::u8vec4 const *src, size_t count) {
+	size_t i = 0;
+#if defined(PNG_ROWS_SSE2)
+	__m128i const alpha = _mm_set1_epi32(int32_t(0xff000000)); //(x86 is little-endian, so alpha is the high byte)
+	for (; i + 4 <= count; i += 4) {
+		__m128i px = _mm_loadu_si128(reinterpret_cast< __m128i const * >(src + i));
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(dst + i), _mm_or_si128(px, alpha));
+	}
+#elif defined(PNG_ROWS_NEON)
+	static uint8_t const AlphaBytes[16] = {0,0,0,0xff, 0,0,0,0xff, 0,0,0,0xff, 0,0,0,0xff};
+	uint8x16_t const alpha = vld1q_u8(AlphaBytes);
+	for (; i + 4 <= count; i += 4) {
+		uint8x16_t px = vld1q_u8(reinterpret_cast< uint8_t const * >(src + i));
+		vst1q_u8(reinterpret_cast< uint8_t * >(dst + i), vorrq_u8(px, alpha));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] = glm::u8vec4(src[i].r, src[i].g, src[i].b, 0xff);
+	}
+}
 
-bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vector< glm::u8vec4 > *data, OriginLocation origin) {
+void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin) {
 	assert(data);
-	uint32_t local_width, local_height;
-	if (width == nullptr) width = &local_width;
-	if (height == nullptr) height = &local_height;
-	*width = *height = 0;
 	data->clear();
-	//..... load file ......
-	//Load a png file, as per the libpng docs:
-	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, (png_voidp)NULL, (png_error_ptr)NULL, (png_error_ptr)NULL);
+	load_png(filename, size, [data](glm::uvec2 const &image_size) {
+		data->resize(size_t(image_size.x) * image_size.y);
+		return data->data();
+	}, origin);
+}
 
-	png_set_read_fn(png, &from, user_read_data);
+void load_png(std::string filename, glm::uvec2 *size, std::function< glm::u8vec4 *(glm::uvec2 const &size) > const &destination, OriginLocation origin, size_t row_stride) {
+	PROFILE_ZONE("load_png");
+	assert(size);
+	*size = glm::uvec2(0);
 
-	if (!png) {
-		LOG_ERROR("  cannot alloc read struct.");
-		return false;
+	std::ifstream file(filename.c_str(), std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Failed to open PNG image file '" + filename + "'.");
 	}
-	png_infop info = png_create_info_struct(png);
-	if (!info) {
-		LOG_ERROR("  cannot alloc info struct.");
-		png_destroy_read_struct(&png, (png_infopp)NULL, (png_infopp)NULL);
-		return false;
+
+	//owns the libpng structures, so they are cleaned up however this function exits:
+	struct Reader {
+		png_structp png = nullptr;
+		png_infop info = nullptr;
+		~Reader() {
+			if (png) png_destroy_read_struct(&png, (info ? &info : (png_infopp)NULL), (png_infopp)NULL);
+		}
+	} reader;
+
+	//..... load file ......
+	//Load a png file, as per the libpng docs:
+	reader.png = png_create_read_struct(PNG_LIBPNG_VER_STRING, (png_voidp)NULL, (png_error_ptr)NULL, (png_error_ptr)NULL);
+	if (!reader.png) {
+		throw std::runtime_error("Failed to allocate PNG read struct for '" + filename + "'.");
+	}
+	reader.info = png_create_info_struct(reader.png);
+	if (!reader.info) {
+		throw std::runtime_error("Failed to allocate PNG info struct for '" + filename + "'.");
 	}
-	png_bytep *row_pointers = NULL;
+	png_structp png = reader.png;
+	png_infop info = reader.info;
+
+	png_set_read_fn(png, file.rdbuf(), user_read_data);
+
+	//NOTE: nothing with a destructor may be declared between here and the end of the function, since libpng errors longjmp back here:
 	if (setjmp(png_jmpbuf(png))) {
-		LOG_ERROR("  png interal error.");
-		png_destroy_read_struct(&png, &info, (png_infopp)NULL);
-		if (row_pointers != NULL) delete[] row_pointers;
-		data->clear();
-		return false;
+		throw std::runtime_error("Failed to read PNG image from '" + filename + "'.");
 	}
 	//not needed with custom read/write functions: png_init_io(png, NULL);
 	png_read_info(png, info);
-	unsigned int w = png_get_image_width(png, info);
-	unsigned int h = png_get_image_height(png, info);
+	uint32_t w = png_get_image_width(png, info);
+	uint32_t h = png_get_image_height(png, info);
 	if (png_get_color_type(png, info) == PNG_COLOR_TYPE_PALETTE)
 		png_set_palette_to_rgb(png);
 	if (png_get_color_type(png, info) == PNG_COLOR_TYPE_GRAY || png_get_color_type(png, info) == PNG_COLOR_TYPE_GRAY_ALPHA)
@@ -102,38 +131,39 @@ bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vec
 		png_set_packing(png);
 	if (png_get_bit_depth(png,info) == 16)
 		png_set_strip_16(png);
+	int passes = png_set_interlace_handling(png); //(1 unless the image is interlaced)
 	//Ok, should be 32-bit RGBA now.
 
 	png_read_update_info(png, info);
-	size_t rowbytes = png_get_rowbytes(png, info);
 	//Make sure it's the format we think it is...
-	assert(rowbytes == w*sizeof(uint32_t));
-
-	data->resize(w*h);
-	row_pointers = new png_bytep[h];
-	for (unsigned int r = 0; r < h; ++r) {
-		if (origin == LowerLeftOrigin) {
-			row_pointers[h-1-r] = (png_bytep)(&(*data)[r*w]);
-		} else {
-			row_pointers[r] = (png_bytep)(&(*data)[r*w]);
+	assert(png_get_rowbytes(png, info) == w*sizeof(uint32_t));
+
+	glm::u8vec4 *pixels = destination(glm::uvec2(w, h));
+	size_t stride = (row_stride ? row_stride : w);
+	assert(pixels && stride >= w);
+
+	//decode row-by-row straight into the destination, flipping by choosing which row to write:
+	for (int pass = 0; pass < passes; ++pass) {
+		for (uint32_t r = 0; r < h; ++r) {
+			uint32_t row = (origin == LowerLeftOrigin ? h - 1 - r : r);
+			png_read_row(png, reinterpret_cast< png_bytep >(pixels + row * stride), NULL);
 		}
 	}
-	png_read_image(png, row_pointers);
-	png_destroy_read_struct(&png, &info, NULL);
-	delete[] row_pointers;
+	png_read_end(png, NULL);
 
-	*width = w;
-	*height = h;
-	return true;
+	*size = glm::uvec2(w, h);
 }
 
+void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, PNGSaveOptions const &options) {
+	PROFILE_ZONE("save_png");
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (!file) {
+		LOG_ERROR("Can't open '" << filename << "' for writing.");
+		return;
+	}
 
-void save_png(std::ostream &to, unsigned int width, unsigned int height, glm::u8vec4 const *data, OriginLocation origin) {
 //After the libpng example.c
 	png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-
-	png_set_write_fn(png_ptr, &to, user_write_data, user_flush_data);
-
 	if (png_ptr == NULL) {
 		LOG_ERROR("Can't create write struct.");
 		return;
@@ -142,34 +172,44 @@ void save_png(std::ostream &to, unsigned int width, unsigned int height, glm::u8
 	png_infop info_ptr = png_create_info_struct(png_ptr);
 	if (info_ptr == NULL) {
 		png_destroy_write_struct(&png_ptr, NULL);
-		LOG_ERROR("Can't craete info pointer");
+		LOG_ERROR("Can't create info pointer");
 		return;
 	}
 
+	png_set_write_fn(png_ptr, file.rdbuf(), user_write_data, user_flush_data);
+
+	//row being written, if it needs fixing up first:
+	vector< glm::u8vec4 > scratch(options.opaque ? size.x : 0);
+
 	if (setjmp(png_jmpbuf(png_ptr))) {
 		png_destroy_write_struct(&png_ptr, &info_ptr);
 		LOG_ERROR("Error writing png.");
 		return;
 	}
 
+	png_set_compression_level(png_ptr, std::clamp(options.level, 0, 9));
+	static int const FilterMasks[] = {
+		PNG_ALL_FILTERS, PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH
+	};
+	png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, FilterMasks[options.filter]);
+
 	//Not needed with custom read/write functions: png_init_io(png_ptr, fp);
-	png_set_IHDR(png_ptr, info_ptr, width, height, 8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+	png_set_IHDR(png_ptr, info_ptr, size.x, size.y, 8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
 
 	png_write_info(png_ptr, info_ptr);
 	//png_set_swap_alpha(png_ptr) // might need?
-	vector< png_bytep > row_pointers(height);
-	for (unsigned int i = 0; i < height; ++i) {
-		if (origin == UpperLeftOrigin) {
-			row_pointers[i] = (png_bytep)&(data[i * width]);
-		} else {
-			row_pointers[i] = (png_bytep)&(data[(height - 1 - i) * width]);
+
+	//write row-by-row, flipping by choosing which row to write next:
+	for (uint32_t i = 0; i < size.y; ++i) {
+		glm::u8vec4 const *row = data + size_t(origin == UpperLeftOrigin ? i : size.y - 1 - i) * size.x;
+		if (options.opaque) {
+			copy_opaque(scratch.data(), row, size.x);
+			row = scratch.data();
 		}
+		png_write_row(png_ptr, reinterpret_cast< png_const_bytep >(row));
 	}
-	png_write_image(png_ptr, &(row_pointers[0]));
 
 	png_write_end(png_ptr, info_ptr);
 
 	png_destroy_write_struct(&png_ptr, &info_ptr);
-
-	return;
 }
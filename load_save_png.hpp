@@ -2,6 +2,7 @@
 
 #include <glm/glm.hpp>
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -17,4 +18,25 @@ enum OriginLocation {
 
 //NOTE: load_png will throw on error
 void load_png(std::string filename, glm::uvec2 *size, std::vector< glm::u8vec4 > *data, OriginLocation origin);
-void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin);
+
+//decode straight into caller-provided memory (e.g., a mapped pixel unpack buffer or a spot in an atlas):
+// 'destination' is called once the image size is known and returns where to put the pixels;
+// rows are written 'row_stride' pixels apart (0 means tightly packed, i.e., size.x)
+void load_png(std::string filename, glm::uvec2 *size, std::function< glm::u8vec4 *(glm::uvec2 const &size) > const &destination, OriginLocation origin, size_t row_stride = 0);
+
+//how save_png should compress:
+struct PNGSaveOptions {
+	int level = 6; //zlib level: 0 (no compression) to 9 (smallest, slowest)
+	enum Filter : uint8_t {
+		Adaptive, //let libpng choose per row (smallest files)
+		None, Sub, Up, Average, Paeth, //use one filter for every row
+	} filter = Adaptive;
+	bool opaque = false; //set alpha to 0xff as rows are written (e.g., for framebuffer readbacks)
+
+	//settings for frame capture -- quick to write, files still reasonably small:
+	static PNGSaveOptions fast() { return PNGSaveOptions{1, Up}; }
+	//no compression at all (fastest; files are about as big as the raw pixels):
+	static PNGSaveOptions uncompressed() { return PNGSaveOptions{0, None}; }
+};
+
+void save_png(std::string filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin, PNGSaveOptions const &options = PNGSaveOptions());
@@ -0,0 +1,203 @@
+//lod-meshes adds coarser levels of detail to every mesh in a ".pnct" file (as written by scenes/export-meshes.py):
+// usage: lod-meshes [--levels N] [--cells C] in.pnct [out.pnct]
+// (out defaults to in; levels already in the file are replaced)
+//
+// Each level is made by vertex clustering: positions are snapped to the
+//  average of the vertices sharing a grid cell, and triangles that collapse
+//  are dropped. The first grid tried has C cells across the mesh's largest
+//  dimension; each following one halves that, and grids that don't remove
+//  at least a quarter of the previous level's triangles are skipped. Corners
+//  keep their own normal, color, and texture coordinate, so flat shading
+//  survives.
+//
+// Levels are appended to the "pnct" chunk and listed in a "lod0" chunk (see
+//  Mesh.hpp), along with how far (in the mesh's units) any vertex moved.
+
+#include "read_write_chunk.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//(matches MeshBuffer's Vertex and IndexEntry, and Mesh's LODEntry; repeated here so this tool needn't pull in OpenGL)
+struct Vertex {
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::u8vec4 Color;
+	glm::vec2 TexCoord;
+};
+static_assert(sizeof(Vertex) == 3*4+3*4+4*1+2*4, "Vertex is packed.");
+
+struct IndexEntry {
+	uint32_t name_begin, name_end;
+	uint32_t vertex_begin, vertex_end;
+};
+static_assert(sizeof(IndexEntry) == 16, "IndexEntry is packed.");
+
+struct LODEntry {
+	uint32_t mesh; //index in "idx0"
+	uint32_t vertex_begin, vertex_end;
+	float error;
+};
+static_assert(sizeof(LODEntry) == 16, "LODEntry is packed.");
+
+//cluster the triangles in 'in' on a grid of 'cell'-sized cells, appending the result to 'out':
+// returns the largest distance any vertex moved
+static float cluster(std::vector< Vertex > const &in, glm::vec3 const &min, float cell, std::vector< Vertex > *out_) {
+	auto &out = *out_;
+
+	auto cell_of = [&](glm::vec3 const &p) {
+		glm::ivec3 c = glm::ivec3(glm::floor((p - min) / cell));
+		return std::array< int32_t, 3 >{c.x, c.y, c.z};
+	};
+
+	//average position in each cell:
+	std::map< std::array< int32_t, 3 >, std::pair< glm::vec3, uint32_t > > cells;
+	for (Vertex const &v : in) {
+		auto &sum = cells.emplace(cell_of(v.Position), std::make_pair(glm::vec3(0.0f), 0u)).first->second;
+		sum.first += v.Position;
+		sum.second += 1;
+	}
+	std::map< std::array< int32_t, 3 >, uint32_t > cell_index;
+	std::vector< glm::vec3 > snapped;
+	for (auto const &[key, sum] : cells) {
+		cell_index.emplace(key, uint32_t(snapped.size()));
+		snapped.emplace_back(sum.first / float(sum.second));
+	}
+
+	float error = 0.0f;
+	std::set< std::array< uint32_t, 3 > > seen; //(so triangles that land on top of each other are only kept once)
+	for (size_t t = 0; t + 2 < in.size(); t += 3) {
+		std::array< uint32_t, 3 > tri;
+		for (uint32_t i = 0; i < 3; ++i) {
+			tri[i] = cell_index.at(cell_of(in[t+i].Position));
+		}
+		if (tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0]) continue; //collapsed
+
+		//same triangle, same winding == same key:
+		std::array< uint32_t, 3 > key = tri;
+		std::rotate(key.begin(), std::min_element(key.begin(), key.end()), key.end());
+		if (!seen.insert(key).second) continue;
+
+		for (uint32_t i = 0; i < 3; ++i) {
+			Vertex v = in[t+i];
+			error = std::max(error, glm::length(snapped[tri[i]] - v.Position));
+			v.Position = snapped[tri[i]];
+			out.emplace_back(v);
+		}
+	}
+	return error;
+}
+
+int main(int argc, char **argv) {
+	try {
+		uint32_t levels = 3;
+		float cells = 16.0f;
+		std::string in, out;
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			if (arg == "--levels" && i + 1 < argc) {
+				levels = uint32_t(std::stoul(argv[++i]));
+			} else if (arg == "--cells" && i + 1 < argc) {
+				cells = std::stof(argv[++i]);
+			} else if (in.empty()) {
+				in = arg;
+			} else if (out.empty()) {
+				out = arg;
+			} else {
+				in = "";
+				break;
+			}
+		}
+		if (in.empty() || !(cells >= 1.0f)) {
+			std::cerr << "Usage:\n\t" << argv[0] << " [--levels N] [--cells C] in.pnct [out.pnct]" << std::endl;
+			return 1;
+		}
+		if (out.empty()) out = in;
+
+		std::vector< Vertex > data;
+		std::vector< char > strings;
+		std::vector< IndexEntry > index;
+		{
+			std::ifstream file(in, std::ios::binary);
+			read_chunk(file, "pnct", &data);
+			read_chunk(file, "str0", &strings);
+			read_chunk(file, "idx0", &index);
+			//(any old levels are dropped, and their vertices with them)
+			if (file.peek() != EOF) {
+				std::vector< LODEntry > old;
+				read_chunk(file, "lod0", &old);
+				uint32_t end = 0;
+				for (IndexEntry const &entry : index) end = std::max(end, entry.vertex_end);
+				data.resize(end);
+			}
+		}
+
+		std::vector< LODEntry > lods;
+		for (uint32_t m = 0; m < index.size(); ++m) {
+			IndexEntry const &entry = index[m];
+			if (!(entry.vertex_begin <= entry.vertex_end && entry.vertex_end <= data.size())) {
+				throw std::runtime_error("index entry has out-of-range vertex start/count");
+			}
+			std::vector< Vertex > mesh(data.begin() + entry.vertex_begin, data.begin() + entry.vertex_end);
+			if (mesh.empty()) continue;
+
+			glm::vec3 min = mesh[0].Position, max = mesh[0].Position;
+			for (Vertex const &v : mesh) {
+				min = glm::min(min, v.Position);
+				max = glm::max(max, v.Position);
+			}
+			float size = std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+			if (size <= 0.0f) continue;
+
+			std::string name(strings.begin() + entry.name_begin, strings.begin() + entry.name_end);
+			std::cout << name << ": " << mesh.size() / 3;
+
+			size_t previous = mesh.size();
+			uint32_t made = 0;
+			for (float cell = size / cells; made < levels && cell <= size; cell *= 2.0f) {
+				std::vector< Vertex > coarse;
+				float error = cluster(mesh, min, cell, &coarse);
+				if (coarse.empty()) break; //nothing left
+				if (coarse.size() > previous * 3 / 4) continue; //not worth a level; try coarser
+				made += 1;
+
+				LODEntry lod;
+				lod.mesh = m;
+				lod.vertex_begin = uint32_t(data.size());
+				data.insert(data.end(), coarse.begin(), coarse.end());
+				lod.vertex_end = uint32_t(data.size());
+				lod.error = error;
+				lods.emplace_back(lod);
+
+				std::cout << " -> " << coarse.size() / 3 << " (error " << error << ")";
+				previous = coarse.size();
+			}
+			std::cout << " triangles" << std::endl;
+		}
+
+		std::ofstream file(out, std::ios::binary);
+		write_chunk("pnct", data, &file);
+		write_chunk("str0", strings, &file);
+		write_chunk("idx0", index, &file);
+		write_chunk("lod0", lods, &file);
+		if (!file) {
+			throw std::runtime_error("Failed to write '" + out + "'.");
+		}
+
+		std::cout << "Wrote " << lods.size() << " level(s) for " << index.size() << " mesh(es) to '" << out << "'." << std::endl;
+	} catch (std::exception &e) {
+		std::cerr << "Exception: " << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
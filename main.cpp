@@ -11,7 +11,13 @@
 #include "GL.hpp"
 
 //for screenshots:
-#include "load_save_png.hpp"
+#include "Screenshot.hpp"
+#include "Texture.hpp"
+
+//for timing (F10 saves a trace, F3 shows an overlay):
+#include "Profiler.hpp"
+#include "PerfStats.hpp"
+#include "GPUTimer.hpp"
 
 //Includes for libSDL:
 #include <SDL3/SDL.h>
@@ -105,6 +111,8 @@ int main(int argc, char **argv) {
 	//Hide mouse cursor (note: showing can be useful for debugging):
 	//SDL_ShowCursor(SDL_DISABLE);
 
+	Profiler::set_thread_name("main");
+
 	//------------ load assets --------------
 	call_load_functions();
 
@@ -132,8 +140,20 @@ int main(int argc, char **argv) {
 	while (Mode::current) {
 		//every pass through the game loop creates one frame of output
 		//  by performing three steps:
+		PROFILE_ZONE("frame");
+
+		//per-phase timing for the performance overlay:
+		PerfStats::Frame perf;
+		uint64_t lap_ns = Profiler::now_ns();
+		auto lap = [&lap_ns]() -> float { //milliseconds since last lap
+			uint64_t now_ns = Profiler::now_ns();
+			float ms = float(now_ns - lap_ns) * 1e-6f;
+			lap_ns = now_ns;
+			return ms;
+		};
 
 		{ //(1) process any events that are pending
+			PROFILE_ZONE("events");
 			static SDL_Event evt;
 			while (SDL_PollEvent(&evt)) {
 				//handle resizing:
@@ -148,24 +168,46 @@ int main(int argc, char **argv) {
 					break;
 				} else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_PRINTSCREEN) {
 					// --- screenshot key ---
+					//(finishes in the background; see Screenshot.hpp)
 					std::string filename = "screenshot.png";
 					std::cout << "Saving screenshot to '" << filename << "'." << std::endl;
-					glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
-					glReadBuffer(GL_FRONT);
-					int w,h;
-					SDL_GetWindowSizeInPixels(Mode::window, &w, &h);
-					std::vector< glm::u8vec4 > data(w*h);
-					glReadPixels(0,0,w,h, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
-					for (auto &px : data) {
-						px.a = 0xff;
+					Screenshot::request(filename, drawable_size);
+				} else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F10) {
+					// --- profile trace key ---
+					std::string filename = "profile.json";
+					std::cout << "Saving profiler trace to '" << filename << "' (open with chrome://tracing or ui.perfetto.dev)." << std::endl;
+					try {
+						Profiler::write_chrome_trace(filename);
+					} catch (std::exception const &e) {
+						//(e.g., the working directory isn't writable -- not worth stopping the game over)
+						std::cerr << "ERROR: " << e.what() << std::endl;
 					}
-					save_png(filename, glm::uvec2(w,h), data.data(), LowerLeftOrigin);
+				} else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F12) {
+					// --- frame capture key ---
+					//(writes capture-000000.png, ...; see Screenshot::Recording for other options)
+					if (Screenshot::is_recording()) Screenshot::stop_recording();
+					else Screenshot::start_recording();
+				} else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F3) {
+					// --- performance overlay key ---
+					PerfStats::show_hud = !PerfStats::show_hud;
+#ifdef GL_TRACE
+				} else if (evt.type == SDL_EVENT_KEY_DOWN && evt.key.key == SDLK_F9) {
+					// --- GL call report key ---
+					GLTrace::report(std::cout);
+#endif
 				}
 			}
 			if (!Mode::current) break;
+
+			//screenshots in progress may be ready for the next step:
+			Screenshot::update();
+			Texture::update();
+
+			perf.events_ms = lap();
 		}
 
 		{ //(2) call the current mode's "update" function to deal with elapsed time:
+			PROFILE_ZONE("update");
 			auto current_time = std::chrono::high_resolution_clock::now();
 			static auto previous_time = current_time;
 			float elapsed = std::chrono::duration< float >(current_time - previous_time).count();
@@ -177,20 +219,36 @@ int main(int argc, char **argv) {
 
 			Mode::current->update(elapsed);
 			if (!Mode::current) break;
+			perf.update_ms = lap();
 		}
 
 		{ //(3) call the current mode's "draw" function to produce output:
-		
+			PROFILE_ZONE("draw");
 			Mode::current->draw(drawable_size);
+			Screenshot::record_frame(drawable_size); //(before the overlay, so it isn't recorded)
+			if (PerfStats::show_hud) PerfStats::draw_hud(drawable_size);
+			GPUTimer::end_frame();
+			perf.draw_ms = lap();
 		}
 
-		//Wait until the recently-drawn frame is shown before doing it all again:
-		SDL_GL_SwapWindow(Mode::window);
+		{ //Wait until the recently-drawn frame is shown before doing it all again:
+			PROFILE_ZONE("swap");
+			SDL_GL_SwapWindow(Mode::window);
+			perf.swap_ms = lap();
+		}
+
+		PerfStats::end_frame(perf);
+#ifdef GL_TRACE
+		GLTrace::end_frame();
+#endif
 	}
 
 
 	//------------  teardown ------------
 
+	Screenshot::finish();
+	Texture::shutdown();
+
 	SDL_GL_DestroyContext(context);
 	context = 0;
 
@@ -2,12 +2,14 @@
 
 #create GL.hpp / GL.cpp by parsing everything from glcorearb.h (why not the regsistry xml, hmmmm?) and selecting only things that are core through version 3_3.
 #get glcorearb.h from https://github.com/KhronosGroup/OpenGL-Registry/raw/master/api/GL/glcorearb.h
+#also creates GL-trace.hpp / GL-trace.cpp, a layer that counts (and can time) every GL call; it is only used when building with GL_TRACE defined.
 
 import re
 
 filtered = []
 lookups = []
 fps = []
+protos = [] #(return type, function name, argument list) for every entry point
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -76,6 +78,8 @@ with open('glcorearb.h', 'r') as f:
 			#check for function prototype lines:
 			m = re.match(r"GLAPI(.*)APIENTRY ([^\s]+) (.*)$", line)
 			if m != None:
+				if mode != "skip":
+					protos.append((m.group(1).strip(), m.group(2), m.group(3).rstrip(";")))
 				if mode == "all_proto":
 					filtered.append(line)
 				elif mode == "win_pointer":
@@ -151,7 +155,12 @@ typedef signed   long  int     khronos_ssize_t;
 	print("\n".join(filtered), file=f)
 
 	print("""
-}""", file=f)
+}
+
+//when building with GL_TRACE defined, every gl* call goes through a counting wrapper:
+#ifdef GL_TRACE
+#include "GL-trace.hpp"
+#endif""", file=f)
 
 
 with open("GL.cpp", "w") as f:
@@ -177,3 +186,165 @@ void init_GL() {""", file=f)
 #ifdef _WIN32""", file=f)
 	print("\t" + "\n\t".join(fps),file=f)
 	print("""#endif""", file=f)
+
+
+#------------------------------------------------
+#tracing layer:
+
+def arg_names(args):
+	#"(GLenum mode, const void *indices)" -> "mode, indices"
+	inner = args.strip()[1:-1].strip()
+	if inner == "void" or inner == "":
+		return ""
+	names = []
+	for arg in inner.split(","):
+		m = re.search(r"(\w+)\s*$", arg)
+		assert m != None, "can't find argument name in '" + arg + "'"
+		names.append(m.group(1))
+	return ", ".join(names)
+
+with open("GL-trace.hpp", "w") as f:
+	print("""#pragma once
+
+/*
+ * Counting (and optionally timing) layer over every OpenGL entry point in GL.hpp.
+ *
+ * Only used when building with GL_TRACE defined (GL.hpp includes this file);
+ *  otherwise gl* calls go straight to OpenGL and this costs nothing.
+ *
+ * With GL_TRACE, every gl* call is replaced (by a macro) with a call to a
+ *  gl_trace_gl* wrapper that counts it (and, if GLTrace::timing is set,
+ *  measures how long the call took on the CPU).
+ *
+ * Call GLTrace::end_frame() once per frame; GLTrace::hottest() then lists
+ *  the previous frame's most-called functions.
+ *
+ * This file has been automatically generated by make-GL.py
+ *
+ */
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace GLTrace {
+	//also measure time spent in each call? (adds two clock reads per call)
+	extern bool timing;
+
+	//per-function numbers for one frame:
+	struct Stat {
+		char const *name;
+		uint64_t calls;
+		uint64_t ns; //only if timing
+	};
+
+	//finish counting a frame:
+	void end_frame();
+
+	//up to 'count' functions from the last finished frame, most calls first:
+	std::vector< Stat > hottest(uint32_t count);
+
+	//write the last finished frame's counts for every called function, most calls first:
+	void report(std::ostream &out);
+}
+""", file=f)
+	for (rt, fn, args) in protos:
+		print(rt + " gl_trace_" + fn + args + ";", file=f)
+	print("""
+//GL-trace.cpp defines GL_TRACE_IMPLEMENTATION so that the wrappers can call the real functions:
+#ifndef GL_TRACE_IMPLEMENTATION""", file=f)
+	for (rt, fn, args) in protos:
+		print("#define " + fn + "(...) gl_trace_" + fn + "(__VA_ARGS__)", file=f)
+	print("#endif", file=f)
+
+with open("GL-trace.cpp", "w") as f:
+	print("""//Wrappers for GL-trace.hpp. This file has been automatically generated by make-GL.py
+#ifdef GL_TRACE
+
+#define GL_TRACE_IMPLEMENTATION
+#include "GL.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ostream>
+
+namespace {
+	constexpr uint32_t Functions = """ + str(len(protos)) + """;
+
+	constexpr std::array< char const *, Functions > names = {""", file=f)
+	print("\t\t" + ",\n\t\t".join('"' + fn + '"' for (rt, fn, args) in protos), file=f)
+	print("""	};
+
+	std::array< uint64_t, Functions > calls{}; //this frame
+	std::array< uint64_t, Functions > ns{};
+	std::array< GLTrace::Stat, Functions > last_frame{};
+
+	uint64_t now_ns() {
+		return uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	//counts (and maybe times) one call over its lifetime:
+	struct Call {
+		Call(uint32_t index_) : index(index_), begin_ns(GLTrace::timing ? now_ns() : 0) {
+			calls[index] += 1;
+		}
+		~Call() {
+			if (begin_ns) ns[index] += now_ns() - begin_ns;
+		}
+		uint32_t index;
+		uint64_t begin_ns;
+	};
+
+	std::vector< GLTrace::Stat > sorted_last_frame() {
+		std::vector< GLTrace::Stat > stats;
+		for (GLTrace::Stat const &stat : last_frame) {
+			if (stat.calls) stats.emplace_back(stat);
+		}
+		std::stable_sort(stats.begin(), stats.end(), [](GLTrace::Stat const &a, GLTrace::Stat const &b){
+			return a.calls > b.calls;
+		});
+		return stats;
+	}
+}
+
+bool GLTrace::timing = false;
+
+void GLTrace::end_frame() {
+	for (uint32_t i = 0; i < Functions; ++i) {
+		last_frame[i] = Stat{names[i], calls[i], ns[i]};
+	}
+	calls.fill(0);
+	ns.fill(0);
+}
+
+std::vector< GLTrace::Stat > GLTrace::hottest(uint32_t count) {
+	std::vector< Stat > stats = sorted_last_frame();
+	if (stats.size() > count) stats.resize(count);
+	return stats;
+}
+
+void GLTrace::report(std::ostream &out) {
+	std::vector< Stat > stats = sorted_last_frame();
+	uint64_t total = 0;
+	for (Stat const &stat : stats) total += stat.calls;
+	out << "GL calls last frame: " << total << "\\n";
+	for (Stat const &stat : stats) {
+		out << "  " << stat.calls << "\\t" << stat.name;
+		if (timing) out << "\\t" << double(stat.ns) * 1e-6 << "ms";
+		out << "\\n";
+	}
+	out.flush();
+}
+""", file=f)
+	for i, (rt, fn, args) in enumerate(protos):
+		call = fn + "(" + arg_names(args) + ")"
+		print(rt + " gl_trace_" + fn + args + " {", file=f)
+		print("\tCall c(" + str(i) + ");", file=f)
+		if rt == "void":
+			print("\t" + call + ";", file=f)
+		else:
+			print("\treturn " + call + ";", file=f)
+		print("}", file=f)
+	print("""
+#endif //GL_TRACE""", file=f)
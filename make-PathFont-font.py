@@ -9,6 +9,8 @@ import xml.parsers.expat
 import re
 import math
 import sys
+import struct
+import zlib
 
 insvg = 'PathFont-font.svg'
 hppname = 'PathFont-font.hpp'
@@ -16,6 +18,14 @@ cppname = hppname[0:-4] + ".cpp"
 
 fontname = 'font'
 
+#signed distance field atlas (for DrawSDFText):
+sdfname = 'dist/PathFont-sdf.png'
+sdf_columns = 16 #glyph i goes in cell (i % sdf_columns, i // sdf_columns), counting up from the lower left
+sdf_cell_min = (-0.25, -0.75) #area of each cell, in font units (glyphs are 1 unit high)
+sdf_cell_max = ( 1.00,  1.25)
+sdf_pixels_per_unit = 32
+sdf_range = 0.25 #distances (to the nearest line) from 0 to sdf_range are stored as 0 to 255
+
 xmlparser = xml.parsers.expat.ParserCreate()
 
 def mul(A,B):
@@ -506,6 +516,40 @@ for char_glyph in sorted(glyphs.items()):
 	for pair in glyph_lines:
 		out_coords += list(pair)
 
+#glyph lookup tables -- a trie of glyph names, plus a direct table for one-byte names:
+NoGlyph = 0xffff
+UseTrie = 0xfffe
+assert(out_glyphs < UseTrie)
+
+class TrieNode:
+	def __init__(self, byte):
+		self.byte = byte
+		self.glyph = NoGlyph
+		self.children = dict()
+		self.first_child = 0
+
+trie_root = TrieNode(0)
+for i in range(0, out_glyphs):
+	node = trie_root
+	for byte in out_chars[out_glyph_char_starts[i]:(out_glyph_char_starts + [len(out_chars)])[i+1]]:
+		if byte not in node.children: node.children[byte] = TrieNode(byte)
+		node = node.children[byte]
+	node.glyph = i
+
+#lay out breadth-first, so each node's children are contiguous (and sorted by byte):
+out_trie = [trie_root]
+for node in out_trie:
+	assert(len(node.children) <= 0xff)
+	node.first_child = len(out_trie)
+	out_trie += [node.children[byte] for byte in sorted(node.children.keys())]
+assert(len(out_trie) <= 0xffff)
+
+out_ascii_glyphs = [NoGlyph] * 128
+for byte, node in trie_root.children.items():
+	if byte >= 128: continue
+	if len(node.children) != 0: out_ascii_glyphs[byte] = UseTrie
+	else: out_ascii_glyphs[byte] = node.glyph
+
 print("Font covers: " + ", ".join(map(lambda x: "'" + x + "'", sorted(glyphs.keys()))))
 missing = []
 for m in range(0x20, 0x7f):
@@ -553,8 +597,67 @@ w('\tconstexpr const float font_coords[' + str(len(out_coords)) + '] = {\n')
 wd(out_coords, "{:.6f}f", 6)
 w('\t};\n')
 
+w('\tconstexpr const uint16_t font_ascii_glyphs[128] = {\n')
+wd(out_ascii_glyphs, "{}", 12)
+w('\t};\n')
+
+w('\tconstexpr const PathFont::TrieNode font_trie[' + str(len(out_trie)) + '] = {\n')
+wd(list(map(lambda n: (n.byte, len(n.children), n.glyph, n.first_child), out_trie)), "{{{0[0]}, {0[1]}, {0[2]}, {0[3]}}}", 6)
+w('\t};\n')
+
+w('\tconstexpr const PathFont::SDF font_sdf = {\n')
+w('\t\t"' + sdfname[len('dist/'):] + '", ' + str(sdf_columns) + ',\n')
+w('\t\t{' + '{:.6f}f, {:.6f}f'.format(*sdf_cell_min) + '}, {' + '{:.6f}f, {:.6f}f'.format(*sdf_cell_max) + '},\n')
+w('\t\t{:.6f}f\n'.format(sdf_range))
+w('\t};\n')
 
 w('}\n')
-w('PathFont PathFont::font(font_glyphs, font_glyph_widths, font_glyph_char_starts, font_chars, font_glyph_coord_starts, font_coords);\n')
+w('constinit const PathFont PathFont::font(font_glyphs, font_glyph_widths, font_glyph_char_starts, font_chars, font_glyph_coord_starts, font_coords, font_ascii_glyphs, font_trie, font_sdf);\n')
 
 cppfile.close()
+
+#------ signed distance field atlas ------
+#(really an unsigned distance to the glyph's lines -- they have no inside -- so text weight can be picked when drawing)
+
+print("Writing distance field atlas to '" + sdfname + "'")
+
+cell_w = round((sdf_cell_max[0] - sdf_cell_min[0]) * sdf_pixels_per_unit)
+cell_h = round((sdf_cell_max[1] - sdf_cell_min[1]) * sdf_pixels_per_unit)
+atlas_w = sdf_columns * cell_w
+atlas_h = ((out_glyphs + sdf_columns - 1) // sdf_columns) * cell_h
+atlas = bytearray(atlas_w * atlas_h) #row 0 is the bottom row
+
+def segment_distance(px, py, ax, ay, bx, by):
+	dx = bx - ax
+	dy = by - ay
+	l2 = dx * dx + dy * dy
+	t = 0.0
+	if l2 > 0.0: t = max(0.0, min(1.0, ((px - ax) * dx + (py - ay) * dy) / l2))
+	ex = ax + t * dx - px
+	ey = ay + t * dy - py
+	return math.sqrt(ex * ex + ey * ey)
+
+coord_ends = out_glyph_coord_starts + [len(out_coords)]
+for g in range(0, out_glyphs):
+	c = out_coords[coord_ends[g]:coord_ends[g+1]]
+	segments = [ (c[i], c[i+1], c[i+2], c[i+3]) for i in range(0, len(c) - 3, 4) ]
+	ox = (g % sdf_columns) * cell_w
+	oy = (g // sdf_columns) * cell_h
+	for y in range(0, cell_h):
+		py = sdf_cell_min[1] + (y + 0.5) / sdf_pixels_per_unit
+		for x in range(0, cell_w):
+			px = sdf_cell_min[0] + (x + 0.5) / sdf_pixels_per_unit
+			d = sdf_range
+			for s in segments:
+				d = min(d, segment_distance(px, py, *s))
+			atlas[(oy + y) * atlas_w + (ox + x)] = round(255 * d / sdf_range)
+
+#8-bit grayscale png (rows stored top first):
+def png_chunk(kind, data):
+	return struct.pack('>I', len(data)) + kind + data + struct.pack('>I', zlib.crc32(kind + data) & 0xffffffff)
+raw = b''.join(b'\x00' + bytes(atlas[y * atlas_w:(y + 1) * atlas_w]) for y in reversed(range(0, atlas_h)))
+with open(sdfname, 'wb') as png:
+	png.write(b'\x89PNG\r\n\x1a\n')
+	png.write(png_chunk(b'IHDR', struct.pack('>IIBBBBB', atlas_w, atlas_h, 8, 0, 0, 0, 0)))
+	png.write(png_chunk(b'IDAT', zlib.compress(raw, 9)))
+	png.write(png_chunk(b'IEND', b''))
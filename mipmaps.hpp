@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <vector>
+#include <cassert>
+
+//helper function that builds a mip chain with a 2x2 box filter:
+// 'pixels' starts with a size.x * size.y image; the smaller levels (down to 1x1) are appended after it.
+// returns the size of every level, largest (i.e., the original image) first.
+// (used by pack-textures and by Texture when loading plain PNGs)
+inline std::vector< glm::uvec2 > make_mipmaps(glm::uvec2 size, std::vector< glm::u8vec4 > *pixels_) {
+	assert(pixels_);
+	auto &pixels = *pixels_;
+	assert(size.x > 0 && size.y > 0 && pixels.size() == size_t(size.x) * size.y);
+
+	std::vector< glm::uvec2 > sizes(1, size);
+	size_t src = 0; //first pixel of the level being filtered
+	while (size.x > 1 || size.y > 1) {
+		glm::uvec2 next = glm::max(size / 2u, glm::uvec2(1));
+		size_t dst = pixels.size();
+		pixels.resize(dst + size_t(next.x) * next.y);
+		for (uint32_t y = 0; y < next.y; ++y) {
+			uint32_t y0 = std::min(2 * y, size.y - 1), y1 = std::min(2 * y + 1, size.y - 1);
+			for (uint32_t x = 0; x < next.x; ++x) {
+				uint32_t x0 = std::min(2 * x, size.x - 1), x1 = std::min(2 * x + 1, size.x - 1);
+				glm::uvec4 sum = glm::uvec4(pixels[src + y0 * size.x + x0]) + glm::uvec4(pixels[src + y0 * size.x + x1])
+				               + glm::uvec4(pixels[src + y1 * size.x + x0]) + glm::uvec4(pixels[src + y1 * size.x + x1]);
+				pixels[dst + y * next.x + x] = glm::u8vec4((sum + 2u) / 4u);
+			}
+		}
+		src = dst;
+		size = next;
+		sizes.emplace_back(size);
+	}
+	return sizes;
+}
@@ -0,0 +1,155 @@
+//pack-textures packs a pile of PNGs into one atlas, builds its mip chain, and writes it as a ".tex" file for Texture:
+// usage: pack-textures [--max-size N] [--padding P] out.tex a.png b.png ...
+// (each image becomes a region named after its file, without directories or ".png": e.g., "grass")
+
+#include "load_save_png.hpp"
+#include "mipmaps.hpp"
+#include "read_write_chunk.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//(matches Texture::Level and Texture::RegionEntry; repeated here so this tool needn't pull in OpenGL)
+struct Level {
+	uint32_t width, height;
+	uint32_t offset;
+};
+static_assert(sizeof(Level) == 12, "Level is packed.");
+
+struct RegionEntry {
+	uint32_t name_begin, name_end;
+	uint32_t x, y, width, height;
+};
+static_assert(sizeof(RegionEntry) == 24, "RegionEntry is packed.");
+
+struct Image {
+	std::string name;
+	glm::uvec2 size;
+	std::vector< glm::u8vec4 > pixels; //bottom row first
+	glm::uvec2 at = glm::uvec2(0); //lower left corner in the atlas (not counting padding)
+};
+
+//shelf packing: place images tallest-first in rows along the bottom of an atlas of 'size':
+// returns false if they don't fit
+static bool pack(std::vector< Image * > const &images, glm::uvec2 size, uint32_t padding) {
+	uint32_t x = 0, y = 0, shelf = 0;
+	for (Image *image : images) {
+		glm::uvec2 padded = image->size + 2u * padding;
+		if (padded.x > size.x) return false;
+		if (x + padded.x > size.x) {
+			y += shelf;
+			x = 0;
+			shelf = 0;
+		}
+		if (y + padded.y > size.y) return false;
+		image->at = glm::uvec2(x, y) + padding;
+		x += padded.x;
+		shelf = std::max(shelf, padded.y);
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	try {
+		uint32_t max_size = 4096;
+		uint32_t padding = 4; //(extended edge pixels, so smaller mip levels don't blend neighbors together)
+		std::string out;
+		std::vector< std::string > ins;
+		for (int i = 1; i < argc; ++i) {
+			std::string arg = argv[i];
+			if (arg == "--max-size" && i + 1 < argc) {
+				max_size = uint32_t(std::stoul(argv[++i]));
+			} else if (arg == "--padding" && i + 1 < argc) {
+				padding = uint32_t(std::stoul(argv[++i]));
+			} else if (out.empty()) {
+				out = arg;
+			} else {
+				ins.emplace_back(arg);
+			}
+		}
+		if (out.empty() || ins.empty()) {
+			std::cerr << "Usage:\n\t" << argv[0] << " [--max-size N] [--padding P] out.tex a.png [b.png ...]" << std::endl;
+			return 1;
+		}
+
+		//load images:
+		std::vector< Image > images(ins.size());
+		for (size_t i = 0; i < ins.size(); ++i) {
+			Image &image = images[i];
+			load_png(ins[i], &image.size, &image.pixels, LowerLeftOrigin);
+			image.name = ins[i].substr(ins[i].find_last_of("/\\") + 1);
+			if (image.name.size() >= 4 && image.name.substr(image.name.size()-4) == ".png") {
+				image.name = image.name.substr(0, image.name.size()-4);
+			}
+		}
+
+		//find the smallest (power-of-two) atlas they fit in:
+		std::vector< Image * > order;
+		for (Image &image : images) order.emplace_back(&image);
+		std::stable_sort(order.begin(), order.end(), [](Image const *a, Image const *b) {
+			return a->size.y > b->size.y;
+		});
+		glm::uvec2 size(1);
+		while (!pack(order, size, padding)) {
+			if (size.x <= size.y) size.x *= 2;
+			else size.y *= 2;
+			if (size.x > max_size || size.y > max_size) {
+				throw std::runtime_error("Images don't fit in a " + std::to_string(max_size) + "x" + std::to_string(max_size) + " atlas (try --max-size).");
+			}
+		}
+
+		//copy into the atlas, extending edges into the padding:
+		std::vector< glm::u8vec4 > pixels(size_t(size.x) * size.y, glm::u8vec4(0x00));
+		for (Image const &image : images) {
+			for (int32_t y = -int32_t(padding); y < int32_t(image.size.y + padding); ++y) {
+				int32_t sy = std::clamp(y, 0, int32_t(image.size.y) - 1);
+				for (int32_t x = -int32_t(padding); x < int32_t(image.size.x + padding); ++x) {
+					int32_t sx = std::clamp(x, 0, int32_t(image.size.x) - 1);
+					pixels[(image.at.y + y) * size.x + (image.at.x + x)] = image.pixels[sy * image.size.x + sx];
+				}
+			}
+		}
+
+		std::vector< Level > levels;
+		uint32_t offset = 0;
+		for (glm::uvec2 const &level : make_mipmaps(size, &pixels)) {
+			levels.emplace_back(Level{level.x, level.y, offset});
+			offset += level.x * level.y;
+		}
+
+		std::vector< char > strings;
+		std::vector< RegionEntry > regions;
+		for (Image const &image : images) {
+			RegionEntry entry;
+			entry.name_begin = uint32_t(strings.size());
+			strings.insert(strings.end(), image.name.begin(), image.name.end());
+			entry.name_end = uint32_t(strings.size());
+			entry.x = image.at.x;
+			entry.y = image.at.y;
+			entry.width = image.size.x;
+			entry.height = image.size.y;
+			regions.emplace_back(entry);
+		}
+
+		std::ofstream file(out, std::ios::binary);
+		write_chunk("tex0", levels, &file);
+		write_chunk("str0", strings, &file);
+		write_chunk("reg0", regions, &file);
+		write_chunk("rgba", pixels, &file);
+		if (!file) {
+			throw std::runtime_error("Failed to write '" + out + "'.");
+		}
+
+		std::cout << "Packed " << images.size() << " image(s) into a " << size.x << "x" << size.y << " atlas with " << levels.size() << " levels in '" << out << "'." << std::endl;
+	} catch (std::exception &e) {
+		std::cerr << "Exception: " << e.what() << std::endl;
+		return 1;
+	}
+	return 0;
+}
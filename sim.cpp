@@ -0,0 +1,375 @@
+//Headless batch runner for the game simulation:
+// steps many independent Worlds (see World.hpp) in parallel -- no window, no OpenGL.
+//
+//Usage:
+//  sim [--seconds S] [--hz H] [--seed N] [--meteors]
+//      [--worlds N] [--threads T] [--sweep NAME=LO:HI:STEPS ...] [--script FILE] [--csv FILE] [--trace FILE]
+//   --seconds S    simulated time to run each world for (default: 60)
+//   --hz H         fixed update rate (default: 60)
+//   --seed N       world i is seeded with N + i (default: 0)
+//   --meteors      turn on meteor showers
+//   --worlds N     number of worlds to simulate (default: 1)
+//   --threads T    worker threads (default: one per core)
+//   --sweep NAME=LO:HI:STEPS
+//                  vary Player constant NAME (e.g. GROUND_ACCEL, JUMP_STRENGTH, METEOR_DAMAGE)
+//                  over STEPS evenly spaced values in [LO,HI]; several sweeps form a grid,
+//                  which is repeated (with different seeds) across the worlds
+//   --script FILE  drive every world with the same scripted inputs instead of random ones
+//   --csv FILE     write one line of results per world to FILE
+//   --trace FILE   record profiler zones and write them to FILE as Chrome trace JSON
+//                  (only the most recent zones on each thread are kept; see Profiler.hpp)
+//
+//Script files have one line per input change; each line is a time (in seconds)
+// followed by the controls held from then on (any of: accelerate left right brake jump):
+//    0.0 accelerate
+//    1.5 accelerate left
+//    2.0 brake
+//    3.1 accelerate jump
+// The last line's controls are held until the end of the run.
+
+#include "World.hpp"
+#include "Profiler.hpp"
+
+//...and for c++ standard library functions:
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//Player constants that --sweep can vary:
+static std::map< std::string, float World::Player::* > const tunables = {
+	{"TURN_SPEED", &World::Player::TURN_SPEED},
+	{"TOP_BASE_SPEED_LATERAL", &World::Player::TOP_BASE_SPEED_LATERAL},
+	{"GROUND_ACCEL", &World::Player::GROUND_ACCEL},
+	{"AIR_ACCEL", &World::Player::AIR_ACCEL},
+	{"FRICTION_DECEL", &World::Player::FRICTION_DECEL},
+	{"JUMP_STRENGTH", &World::Player::JUMP_STRENGTH},
+	{"CHARGE_TIME", &World::Player::CHARGE_TIME},
+	{"BOOST_POWER", &World::Player::BOOST_POWER},
+	{"BOOST_TIME", &World::Player::BOOST_TIME},
+	{"SPRING_STRENGTH", &World::Player::SPRING_STRENGTH},
+	{"FLAME_DPS", &World::Player::FLAME_DPS},
+	{"METEOR_DAMAGE", &World::Player::METEOR_DAMAGE},
+	{"SCORE_GAIN", &World::Player::SCORE_GAIN},
+	{"MULTIPLIER_GAIN", &World::Player::MULTIPLIER_GAIN},
+};
+
+struct Sweep {
+	std::string name;
+	float World::Player::*member = nullptr;
+	float lo = 0.0f, hi = 0.0f;
+	uint32_t steps = 1;
+};
+
+struct ScriptEntry {
+	float time = 0.0f;
+	World::Controls controls;
+};
+
+//produces the controls for one world, one step at a time:
+struct Driver {
+	std::vector< ScriptEntry > const *script = nullptr; //if null, inputs are random
+	uint32_t next = 0; //next script entry to apply
+
+	std::minstd_rand rng;
+	static constexpr float InputHold = 0.5f; //seconds to hold each randomly chosen input
+	float hold = 0.0f;
+
+	World::Controls controls;
+
+	void step(float time, float elapsed) {
+		if (script) {
+			while (next < script->size() && (*script)[next].time <= time) {
+				controls = (*script)[next].controls;
+				next += 1;
+			}
+		} else {
+			hold -= elapsed;
+			if (hold <= 0.0f) {
+				hold += InputHold;
+				uint32_t bits = uint32_t(rng());
+				controls.left = (bits & 0x3) == 0x1;
+				controls.right = (bits & 0x3) == 0x2;
+				controls.accelerate = (bits & 0x1c) != 0; //mostly accelerating
+				controls.brake = (bits & 0xe0) == 0;
+				controls.jump = (bits & 0x700) == 0;
+			}
+		}
+	}
+};
+
+//what happened in one world over the whole run:
+struct Result {
+	uint32_t seed = 0;
+	std::vector< float > params; //one per sweep
+	uint32_t rounds = 0; //rounds ended by falling out of the arena
+	float best_score = 0.0f;
+	float total_score = 0.0f;
+	float final_health = 0.0f;
+	float final_multiplier = 0.0f;
+	size_t peak_dynamic_bytes = 0; //meteor + flame storage
+};
+
+static std::vector< ScriptEntry > load_script(std::string const &filename) {
+	std::ifstream file(filename);
+	if (!file) throw std::runtime_error("failed to open script '" + filename + "'");
+	std::vector< ScriptEntry > script;
+	std::string line;
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == '#') continue;
+		std::istringstream words(line);
+		ScriptEntry entry;
+		if (!(words >> entry.time)) throw std::runtime_error("script line '" + line + "' doesn't start with a time");
+		if (!script.empty() && entry.time < script.back().time) throw std::runtime_error("script times must not decrease");
+		std::string word;
+		while (words >> word) {
+			if (word == "accelerate") entry.controls.accelerate = true;
+			else if (word == "left") entry.controls.left = true;
+			else if (word == "right") entry.controls.right = true;
+			else if (word == "brake") entry.controls.brake = true;
+			else if (word == "jump") entry.controls.jump = true;
+			else throw std::runtime_error("unknown control '" + word + "' in script");
+		}
+		script.emplace_back(entry);
+	}
+	return script;
+}
+
+static Sweep parse_sweep(std::string const &arg) {
+	Sweep sweep;
+	size_t eq = arg.find('=');
+	if (eq == std::string::npos) throw std::runtime_error("expecting --sweep NAME=LO:HI:STEPS, got '" + arg + "'");
+	sweep.name = arg.substr(0, eq);
+	auto f = tunables.find(sweep.name);
+	if (f == tunables.end()) {
+		std::string known;
+		for (auto const &t : tunables) known += " " + t.first;
+		throw std::runtime_error("can't sweep '" + sweep.name + "'; known constants:" + known);
+	}
+	sweep.member = f->second;
+	std::string range = arg.substr(eq + 1);
+	std::replace(range.begin(), range.end(), ':', ' ');
+	std::istringstream values(range);
+	if (!(values >> sweep.lo >> sweep.hi >> sweep.steps) || sweep.steps == 0) {
+		throw std::runtime_error("expecting --sweep NAME=LO:HI:STEPS, got '" + arg + "'");
+	}
+	return sweep;
+}
+
+int main(int argc, char **argv) {
+	//------------ parse arguments ------------
+	float seconds = 60.0f;
+	float hz = 60.0f;
+	uint32_t seed = 0;
+	bool meteors = false;
+	uint32_t world_count = 1;
+	uint32_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+	std::vector< Sweep > sweeps;
+	std::vector< ScriptEntry > script;
+	bool scripted = false;
+	std::string csv_filename;
+	std::string trace_filename;
+
+	try {
+		for (int argi = 1; argi < argc; ++argi) {
+			std::string arg = argv[argi];
+			if (arg == "--seconds" && argi + 1 < argc) {
+				seconds = std::stof(argv[++argi]);
+			} else if (arg == "--hz" && argi + 1 < argc) {
+				hz = std::stof(argv[++argi]);
+			} else if (arg == "--seed" && argi + 1 < argc) {
+				seed = uint32_t(std::stoul(argv[++argi]));
+			} else if (arg == "--meteors") {
+				meteors = true;
+			} else if (arg == "--worlds" && argi + 1 < argc) {
+				world_count = uint32_t(std::stoul(argv[++argi]));
+			} else if (arg == "--threads" && argi + 1 < argc) {
+				thread_count = uint32_t(std::stoul(argv[++argi]));
+			} else if (arg == "--sweep" && argi + 1 < argc) {
+				sweeps.emplace_back(parse_sweep(argv[++argi]));
+			} else if (arg == "--script" && argi + 1 < argc) {
+				script = load_script(argv[++argi]);
+				scripted = true;
+			} else if (arg == "--csv" && argi + 1 < argc) {
+				csv_filename = argv[++argi];
+			} else if (arg == "--trace" && argi + 1 < argc) {
+				trace_filename = argv[++argi];
+			} else {
+				throw std::runtime_error("unrecognized argument '" + arg + "'");
+			}
+		}
+		if (!(seconds >= 0.0f) || !std::isfinite(seconds)) throw std::runtime_error("--seconds must be a non-negative number");
+		if (!(hz > 0.0f) || !std::isfinite(hz)) throw std::runtime_error("--hz must be positive");
+		if (!(double(seconds) * double(hz) < 1e18)) throw std::runtime_error("--seconds times --hz is too many ticks");
+		if (world_count == 0) throw std::runtime_error("--worlds must be positive");
+		if (thread_count == 0) throw std::runtime_error("--threads must be positive");
+	} catch (std::exception const &e) {
+		std::cerr << "Error: " << e.what() << "\n"
+		          << "Usage:\n\t" << argv[0] << " [--seconds S] [--hz H] [--seed N] [--meteors] [--worlds N] [--threads T]\n"
+		          << "\t\t[--sweep NAME=LO:HI:STEPS ...] [--script FILE] [--csv FILE] [--trace FILE]" << std::endl;
+		return 1;
+	}
+	thread_count = std::min(thread_count, world_count);
+
+	//zones are only worth their (small) cost if someone will look at them:
+	Profiler::enabled = !trace_filename.empty();
+
+	float elapsed = 1.0f / hz;
+	uint64_t ticks = uint64_t(seconds * hz);
+
+	//------------ set up worlds ------------
+	//sweep values for world i (sweeps form a grid; grid cells repeat across worlds):
+	uint32_t cells = 1;
+	for (Sweep const &sweep : sweeps) cells *= sweep.steps;
+	auto params_for = [&](uint32_t index) {
+		std::vector< float > params;
+		uint32_t cell = index % cells;
+		for (Sweep const &sweep : sweeps) {
+			uint32_t step = cell % sweep.steps;
+			cell /= sweep.steps;
+			float amt = (sweep.steps > 1 ? float(step) / float(sweep.steps - 1) : 0.0f);
+			params.emplace_back(sweep.lo + (sweep.hi - sweep.lo) * amt);
+		}
+		return params;
+	};
+	auto make_world = [&](uint32_t world_seed, std::vector< float > const &params) {
+		World world(world_seed);
+		world.meteors_enabled = meteors;
+		for (uint32_t s = 0; s < sweeps.size(); ++s) {
+			world.player.*(sweeps[s].member) = params[s];
+		}
+		return world;
+	};
+
+	std::vector< World > worlds;
+	std::vector< Driver > drivers(world_count);
+	std::vector< Result > results(world_count);
+	worlds.reserve(world_count);
+	for (uint32_t i = 0; i < world_count; ++i) {
+		results[i].seed = seed + i;
+		results[i].params = params_for(i);
+		worlds.emplace_back(make_world(results[i].seed, results[i].params));
+		drivers[i].rng.seed(results[i].seed ^ 0x9e3779b9u);
+		if (scripted) drivers[i].script = &script;
+	}
+
+	//------------ run ------------
+	//each world is stepped start-to-finish by one thread (so its state stays in that core's cache);
+	// threads grab small batches of worlds until none are left:
+	constexpr uint32_t Batch = 8;
+	std::atomic< uint32_t > next_world(0);
+
+	auto run_worlds = [&](uint32_t thread_index) {
+		if (Profiler::enabled) Profiler::set_thread_name("worker " + std::to_string(thread_index));
+		while (true) {
+			uint32_t begin = next_world.fetch_add(Batch);
+			if (begin >= world_count) break;
+			uint32_t end = std::min(world_count, begin + Batch);
+			for (uint32_t i = begin; i < end; ++i) {
+				World &world = worlds[i];
+				Driver &driver = drivers[i];
+				Result &result = results[i];
+				PROFILE_ZONE("world");
+				float time = 0.0f;
+				for (uint64_t tick = 0; tick < ticks; ++tick) {
+					driver.step(time, elapsed);
+					world.update(elapsed, driver.controls);
+					time += elapsed;
+
+					result.peak_dynamic_bytes = std::max(result.peak_dynamic_bytes,
+						world.meteors.capacity() * sizeof(World::Meteor) + world.flames.capacity() * sizeof(World::Flame));
+
+					//fell out of the arena? start a new round (just like PlayMode does):
+					if (world.fell_off) {
+						result.rounds += 1;
+						result.best_score = std::max(result.best_score, world.player.score);
+						result.total_score += world.player.score;
+						world = make_world(result.seed + result.rounds * world_count, result.params);
+					}
+				}
+				result.best_score = std::max(result.best_score, world.player.score);
+				result.total_score += world.player.score;
+				result.final_health = world.player.health;
+				result.final_multiplier = world.player.multiplier;
+			}
+		}
+	};
+
+	auto before = std::chrono::high_resolution_clock::now();
+	{
+		std::vector< std::thread > threads;
+		for (uint32_t t = 1; t < thread_count; ++t) {
+			threads.emplace_back(run_worlds, t);
+		}
+		run_worlds(0); //main thread works too
+		for (auto &thread : threads) {
+			thread.join();
+		}
+	}
+	auto after = std::chrono::high_resolution_clock::now();
+	double wall = std::chrono::duration< double >(after - before).count();
+
+	//------------ report ------------
+	uint64_t total_ticks = ticks * world_count;
+	std::cout << "Simulated " << world_count << " world(s) x " << ticks << " ticks (" << seconds << "s at " << hz << "hz)"
+	          << " on " << thread_count << " thread(s) in " << wall << "s of wall time.\n";
+	if (wall > 0.0) {
+		std::cout << "  " << double(total_ticks) / wall << " ticks/s aggregate, "
+		          << double(total_ticks) / wall / thread_count << " ticks/s per thread.\n";
+	}
+
+	size_t peak_dynamic_bytes = 0;
+	for (Result const &result : results) peak_dynamic_bytes = std::max(peak_dynamic_bytes, result.peak_dynamic_bytes);
+	size_t shared_bytes = worlds[0].static_colliders->colliders.capacity() * sizeof(World::Collider)
+	                    + worlds[0].static_colliders->groups.capacity() * sizeof(World::StaticColliders::Group);
+	std::cout << "  per-world memory: " << sizeof(World) << " bytes + " << sizeof(Driver) << " bytes of input state"
+	          << " + up to " << peak_dynamic_bytes << " bytes of meteors/flames"
+	          << " (static colliders: " << shared_bytes << " bytes, shared by all worlds).\n";
+
+	if (world_count == 1) {
+		Result const &result = results[0];
+		std::cout << "  " << result.rounds << " round(s) ended; best score " << int(result.best_score)
+		          << ", final health " << result.final_health << ", final multiplier " << result.final_multiplier << "\n";
+	}
+	std::cout.flush();
+
+	if (!csv_filename.empty()) {
+		std::ofstream csv(csv_filename);
+		csv << "world,seed";
+		for (Sweep const &sweep : sweeps) csv << "," << sweep.name;
+		csv << ",rounds,best_score,mean_score,final_health,final_multiplier\n";
+		for (uint32_t i = 0; i < world_count; ++i) {
+			Result const &result = results[i];
+			csv << i << "," << result.seed;
+			for (float param : result.params) csv << "," << param;
+			csv << "," << result.rounds << "," << result.best_score << "," << result.total_score / float(result.rounds + 1)
+			    << "," << result.final_health << "," << result.final_multiplier << "\n";
+		}
+		if (!csv) {
+			std::cerr << "Error writing '" << csv_filename << "'." << std::endl;
+			return 1;
+		}
+		std::cout << "Wrote per-world results to '" << csv_filename << "'." << std::endl;
+	}
+
+	if (!trace_filename.empty()) {
+		try {
+			Profiler::write_chrome_trace(trace_filename);
+		} catch (std::exception const &e) {
+			std::cerr << "Error: " << e.what() << std::endl;
+			return 1;
+		}
+		std::cout << "Wrote profiler trace to '" << trace_filename << "'." << std::endl;
+	}
+
+	return 0;
+}